@@ -0,0 +1,185 @@
+/**
+ * @file engine_stress.cpp
+ * @brief      Teste de carga concorrente do Engine
+ * @details    Um único Engine const é compartilhado por 1, 2, 4, ... até N
+ *             threads. Cada thread avalia todo o arquivo de expressões várias
+ *             vezes com o seu próprio Engine::Context e acumula um checksum
+ *             dos resultados; todos os checksums precisam ser iguais ao da
+ *             execução com uma thread. Os contadores de cada thread ficam em
+ *             linhas de cache separadas, então a única coisa medida é a
+ *             escalabilidade da avaliação. Para cada quantidade de threads são
+ *             exibidas a vazão, a aceleração e a eficiência em relação a uma
+ *             thread.
+ *
+ *             Uso: ./bin/engine_stress arquivo_entrada [threads] [repeticoes]
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::max
+#include <chrono>   	// std::chrono
+#include <cstdint>  	// std::uint64_t
+#include <cstdlib>  	// std::strtoul
+#include <fstream>  	// std::ifstream
+#include <functional>	// std::cref, std::ref
+#include <iomanip>  	// std::setw
+#include <iostream> 	// std::cout
+#include <string>   	// std::string
+#include <thread>   	// std::thread
+#include <vector>   	// std::vector
+
+#include "engine.hpp"
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief      Contadores de uma thread, cada um na sua linha de cache
+ */
+struct alignas( Engine::CACHE_LINE ) Slot
+{
+	std::uint64_t evaluated = 0;
+	std::uint64_t checksum = 0;
+};
+
+/**
+ * @brief      Avalia o arquivo repetições vezes e acumula o checksum
+ *
+ * @param[in]  engine       O Engine compartilhado
+ * @param[in]  corpus       As expressões
+ * @param[in]  repetitions  Passadas pelo arquivo
+ * @param      slot         Onde gravar os contadores
+ */
+void work( const Engine & engine, const std::vector< std::string > & corpus, std::size_t repetitions, Slot & slot )
+{
+	Engine::Context ctx;
+	std::uint64_t evaluated = 0;
+	std::uint64_t checksum = 0;
+
+	for ( std::size_t r = 0; r < repetitions; ++r )
+	{
+		checksum = 0;
+		for ( const auto & expr : corpus )
+		{
+			auto result = engine.evaluate( expr, ctx );
+
+			checksum = checksum * 31 + result.parsed.type;
+			checksum = checksum * 31 + static_cast< std::uint64_t >( result.parsed.at_col );
+			checksum = checksum * 31 + result.evaluated.type;
+			checksum = checksum * 31 + static_cast< std::uint64_t >( result.evaluated.value );
+			++evaluated;
+		}
+	}
+
+	// Uma escrita por thread no fim, e não uma por expressão
+	slot.evaluated = evaluated;
+	slot.checksum = checksum;
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0 se todas as threads obtiveram os mesmos resultados, 1 caso
+ *             contrário
+ */
+int main( int argc, char const *argv[] )
+{
+	if ( argc < 2 )
+	{
+		std::cerr << "Uso: " << argv[0] << " arquivo_entrada [threads] [repeticoes]\n";
+		return 1;
+	}
+
+	std::ifstream file( argv[1] );
+	if ( not file )
+	{
+		std::cerr << "engine_stress: cannot open " << argv[1] << "\n";
+		return 1;
+	}
+
+	std::size_t max_threads = argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 0;
+	if ( max_threads == 0 )
+	{
+		max_threads = std::max( 1u, std::thread::hardware_concurrency() );
+	}
+
+	std::size_t repetitions = argc > 3 ? std::strtoul( argv[3], nullptr, 10 ) : 20;
+	if ( repetitions == 0 )
+	{
+		repetitions = 1;
+	}
+
+	std::vector< std::string > corpus;
+	std::string line;
+	while ( std::getline( file, line ) and line != "q" and line != "p" )
+	{
+		corpus.push_back( line );
+	}
+
+	const Engine engine{};
+
+	Slot reference;
+	work( engine, corpus, 1, reference );
+
+	std::cout << "corpus: " << corpus.size() << " expressions, " << repetitions << " passes per thread\n\n";
+	std::cout << std::setw( 8 ) << "threads" << std::setw( 16 ) << "expr/s" << std::setw( 10 ) << "speedup"
+		<< std::setw( 12 ) << "efficiency" << "\n";
+
+	double base = 0;
+	bool consistent = true;
+
+	// Potências de 2 e, por último, a quantidade pedida
+	std::vector< std::size_t > counts;
+	for ( std::size_t n = 1; n < max_threads; n *= 2 )
+	{
+		counts.push_back( n );
+	}
+	counts.push_back( max_threads );
+
+	for ( auto n : counts )
+	{
+		std::vector< Slot > slots( n );
+		std::vector< std::thread > threads;
+
+		auto start = clock_type::now();
+		for ( std::size_t t = 0; t < n; ++t )
+		{
+			threads.emplace_back( work, std::cref( engine ), std::cref( corpus ), repetitions, std::ref( slots[ t ] ) );
+		}
+		for ( auto & t : threads )
+		{
+			t.join();
+		}
+		double elapsed = std::chrono::duration< double >( clock_type::now() - start ).count();
+
+		std::uint64_t total = 0;
+		for ( const auto & s : slots )
+		{
+			total += s.evaluated;
+			consistent = consistent and s.checksum == reference.checksum;
+		}
+
+		double rate = elapsed > 0 ? total / elapsed : 0;
+		if ( n == 1 )
+		{
+			base = rate;
+		}
+
+		double speedup = base > 0 ? rate / base : 0;
+		std::cout << std::fixed << std::setprecision( 0 ) << std::setw( 8 ) << n << std::setw( 16 ) << rate
+			<< std::setprecision( 2 ) << std::setw( 10 ) << speedup << std::setw( 12 ) << speedup / n << "\n";
+	}
+
+	if ( not consistent )
+	{
+		std::cout << "\nresults differ between threads\n";
+		return 1;
+	}
+
+	std::cout << "\nall threads matched the single-threaded results\n";
+	return 0;
+}
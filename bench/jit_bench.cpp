@@ -0,0 +1,148 @@
+/**
+ * @file jit_bench.cpp
+ * @brief      Compara o caminho atual ( Evaluator::evaluate_postfix ), o
+ *             interpretador de Program e a JitExpression
+ * @details    Cada expressão ( uma por linha da entrada padrão ) é avaliada
+ *             repetidas vezes pelos três caminhos. O interpretador e o JIT
+ *             recebem valores diferentes nos slots a cada iteração e os
+ *             resultados são conferidos contra o Evaluator.
+ *
+ *             Uso: ./bin/jit_bench [iterações] < arquivo_entrada
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <chrono>   	// std::chrono
+#include <cstdlib>  	// std::strtoul
+#include <iomanip>  	// std::setw
+#include <iostream> 	// std::cout
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "parser.hpp"
+#include "evaluator.hpp"
+#include "program.hpp"
+#include "jit.hpp"
+
+using value_type = Evaluator::value_type;
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief      Gera variações dos literais, mantendo-os na faixa do Parser
+ *
+ * @param[in]  base   Valores originais dos slots
+ * @param[in]  count  Quantidade de variações
+ *
+ * @return     count * base.size() valores, uma variação após a outra
+ */
+std::vector< value_type > make_inputs( const std::vector< value_type > & base, std::size_t count )
+{
+	std::vector< value_type > inputs;
+	inputs.reserve( base.size() * count );
+
+	for ( std::size_t i = 0; i < count; ++i )
+	{
+		for ( auto v : base )
+		{
+			inputs.push_back( ( v + static_cast< value_type >( i % 7 ) ) % 32000 );
+		}
+	}
+
+	return inputs;
+}
+
+/**
+ * @brief      Imprime uma linha da tabela de tempos
+ */
+void report( const std::string & name, clock_type::duration d, std::size_t runs, long checksum )
+{
+	auto ns = std::chrono::duration_cast< std::chrono::nanoseconds >( d ).count();
+
+	std::cout << "  " << std::setw( 12 ) << std::left << name
+	          << std::setw( 12 ) << std::right << std::fixed << std::setprecision( 2 )
+	          << static_cast< double >( ns ) / runs << " ns/eval"
+	          << "   (checksum " << checksum << ")\n";
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0 se todos os caminhos concordaram, 1 caso contrário
+ */
+int main( int argc, char const *argv[] )
+{
+	std::size_t iterations = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1000000;
+	constexpr std::size_t VARIANTS = 64;
+
+	Parser parser;
+	Evaluator evaluator;
+	std::string line;
+	int status = 0;
+
+	while ( std::getline( std::cin, line ) )
+	{
+		if ( parser.parse( line ).type != Parser::ParserResult::PARSER_OK )
+		{
+			continue;
+		}
+
+		auto postfix = evaluator.infix_to_postfix( parser.get_tokens() );
+		Program program( postfix );
+		JitExpression jit( program );
+
+		auto inputs = make_inputs( program.slots(), VARIANTS );
+		auto slots = program.slot_count();
+
+		// Confere que os três caminhos concordam
+		for ( std::size_t i = 0; i < VARIANTS; ++i )
+		{
+			auto a = program.run( &inputs[ i * slots ] );
+			auto b = jit.run( &inputs[ i * slots ] );
+			if ( a.value != b.value or a.type != b.type )
+			{
+				std::cout << "MISMATCH in \"" << line << "\" variant " << i << "\n";
+				status = 1;
+			}
+		}
+		auto reference = evaluator.evaluate_postfix( postfix );
+		auto original = jit.run();
+		if ( reference.value != original.value or reference.type != original.type )
+		{
+			std::cout << "MISMATCH in \"" << line << "\" against Evaluator\n";
+			status = 1;
+		}
+
+		std::cout << line << "  [" << ( jit.is_native() ? "native" : "fallback" ) << "]\n";
+
+		long checksum = 0;
+		auto start = clock_type::now();
+		for ( std::size_t i = 0; i < iterations / 100 + 1; ++i )
+		{
+			checksum += evaluator.evaluate_postfix( postfix ).value;
+		}
+		report( "evaluator", clock_type::now() - start, iterations / 100 + 1, checksum );
+
+		checksum = 0;
+		start = clock_type::now();
+		for ( std::size_t i = 0; i < iterations; ++i )
+		{
+			checksum += program.run( &inputs[ ( i % VARIANTS ) * slots ] ).value;
+		}
+		report( "interpreter", clock_type::now() - start, iterations, checksum );
+
+		checksum = 0;
+		start = clock_type::now();
+		for ( std::size_t i = 0; i < iterations; ++i )
+		{
+			checksum += jit.run( &inputs[ ( i % VARIANTS ) * slots ] ).value;
+		}
+		report( "jit", clock_type::now() - start, iterations, checksum );
+	}
+
+	return status;
+}
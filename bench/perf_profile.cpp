@@ -0,0 +1,385 @@
+/**
+ * @file perf_profile.cpp
+ * @brief      Contadores de hardware por etapa do bares
+ * @details    Mede, com perf_event_open, ciclos, instruções, falhas de
+ *             predição de desvio, faltas na L1 e na LLC e faltas de página de
+ *             cada etapa ( Parser::parse, Evaluator::infix_to_postfix e
+ *             Evaluator::evaluate_postfix ) sobre um arquivo de expressões.
+ *             Cada etapa roda sobre todo o arquivo com os contadores ligados
+ *             apenas em volta dela, e os números são normalizados por
+ *             expressão e por byte de entrada. Contadores indisponíveis ( por
+ *             exemplo em contêineres, ou com perf_event_paranoid alto ) são
+ *             marcados como "n/a" e o tempo de relógio continua sendo medido.
+ *
+ *             Uso: ./bin/perf_profile arquivo_entrada [repetições]
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <chrono>   	// std::chrono
+#include <cstdint>  	// std::uint64_t
+#include <cstdlib>  	// std::strtoul
+#include <cstring>  	// std::strerror, std::memset
+#include <cerrno>   	// errno
+#include <fstream>  	// std::ifstream
+#include <iomanip>  	// std::setw
+#include <iostream> 	// std::cout
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#if defined( __linux__ )
+#include <linux/perf_event.h>	// perf_event_attr
+#include <sys/ioctl.h>       	// ioctl
+#include <sys/syscall.h>     	// SYS_perf_event_open
+#include <unistd.h>          	// syscall, read, close
+#define BARES_HAS_PERF 1
+#endif
+
+#include "parser.hpp"
+#include "evaluator.hpp"
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief      Um contador de hardware ( ou de software ) do kernel
+ */
+struct Counter
+{
+	const char * name;    // Nome exibido na tabela
+	std::uint32_t type;   // perf_event_attr::type
+	std::uint64_t config; // perf_event_attr::config
+	int fd = -1;          // Descritor, -1 se indisponível
+	int error = 0;        // errno de perf_event_open quando indisponível
+};
+
+/**
+ * @brief      Conjunto de contadores ligados em volta de cada etapa
+ */
+class PerfCounters
+{
+	private:
+
+		std::vector< Counter > counters;
+
+	public:
+
+		PerfCounters()
+		{
+#if defined( BARES_HAS_PERF )
+			auto cache = []( std::uint64_t id ) -> std::uint64_t
+			{
+				return id | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+			};
+
+			counters = {
+				{ "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+				{ "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+				{ "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+				{ "L1d-misses",    PERF_TYPE_HW_CACHE, cache( PERF_COUNT_HW_CACHE_L1D ) },
+				{ "LLC-misses",    PERF_TYPE_HW_CACHE, cache( PERF_COUNT_HW_CACHE_LL ) },
+				{ "page-faults",   PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+			};
+
+			// Cada contador é aberto sozinho: se um deles não existe nesta
+			// máquina os outros continuam funcionando
+			for ( auto & c : counters )
+			{
+				perf_event_attr attr;
+				std::memset( &attr, 0, sizeof( attr ) );
+				attr.size = sizeof( attr );
+				attr.type = c.type;
+				attr.config = c.config;
+				attr.disabled = 1;
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+				c.fd = static_cast< int >( syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0 ) );
+				if ( c.fd < 0 )
+				{
+					c.error = errno;
+				}
+			}
+#else
+			counters = {
+				{ "cycles", 0, 0 }, { "instructions", 0, 0 }, { "branch-misses", 0, 0 },
+				{ "L1d-misses", 0, 0 }, { "LLC-misses", 0, 0 }, { "page-faults", 0, 0 },
+			};
+			for ( auto & c : counters )
+			{
+				c.error = ENOSYS;
+			}
+#endif
+		}
+
+		~PerfCounters()
+		{
+#if defined( BARES_HAS_PERF )
+			for ( auto & c : counters )
+			{
+				if ( c.fd >= 0 )
+				{
+					close( c.fd );
+				}
+			}
+#endif
+		}
+
+		PerfCounters( const PerfCounters & other ) = delete;
+		PerfCounters & operator=( const PerfCounters & other ) = delete;
+
+		const std::vector< Counter > & list( void ) const
+		{
+			return counters;
+		}
+
+		/**
+		 * @brief      Zera e liga todos os contadores disponíveis
+		 */
+		void start( void )
+		{
+#if defined( BARES_HAS_PERF )
+			for ( auto & c : counters )
+			{
+				if ( c.fd >= 0 )
+				{
+					ioctl( c.fd, PERF_EVENT_IOC_RESET, 0 );
+					ioctl( c.fd, PERF_EVENT_IOC_ENABLE, 0 );
+				}
+			}
+#endif
+		}
+
+		/**
+		 * @brief      Desliga os contadores e lê os valores
+		 *
+		 * @return     Um valor por contador ( escalado se o kernel multiplexou
+		 *             os contadores ), -1 se indisponível
+		 */
+		std::vector< double > stop( void )
+		{
+			std::vector< double > values( counters.size(), -1 );
+
+#if defined( BARES_HAS_PERF )
+			for ( auto & c : counters )
+			{
+				if ( c.fd >= 0 )
+				{
+					ioctl( c.fd, PERF_EVENT_IOC_DISABLE, 0 );
+				}
+			}
+
+			for ( std::size_t i = 0; i < counters.size(); ++i )
+			{
+				std::uint64_t data[3]; // valor, tempo habilitado, tempo rodando
+				if ( counters[ i ].fd < 0 or read( counters[ i ].fd, data, sizeof( data ) ) != sizeof( data ) )
+				{
+					continue;
+				}
+				if ( data[2] == 0 )
+				{
+					values[ i ] = data[1] == 0 ? 0 : -1;
+					continue;
+				}
+				values[ i ] = static_cast< double >( data[0] ) * data[1] / data[2];
+			}
+#endif
+
+			return values;
+		}
+};
+
+/**
+ * @brief      Resultado de uma etapa
+ */
+struct Stage
+{
+	std::string name;
+	std::vector< double > values;
+	double ns;
+	std::size_t expressions;
+	std::size_t bytes;
+};
+
+/**
+ * @brief      Roda uma etapa com os contadores ligados
+ *
+ * @param      perf         Os contadores
+ * @param[in]  name         Nome da etapa
+ * @param[in]  expressions  Expressões processadas por repetição
+ * @param[in]  bytes        Bytes processados por repetição
+ * @param[in]  repetitions  Repetições
+ * @param[in]  body         A etapa
+ *
+ * @tparam     Body         Função sem parâmetros
+ *
+ * @return     Os valores medidos, já divididos pelas repetições
+ */
+template < typename Body >
+Stage measure( PerfCounters & perf, const std::string & name, std::size_t expressions, std::size_t bytes,
+               std::size_t repetitions, Body body )
+{
+	perf.start();
+	auto begin = clock_type::now();
+
+	for ( std::size_t r = 0; r < repetitions; ++r )
+	{
+		body();
+	}
+
+	auto end = clock_type::now();
+	auto values = perf.stop();
+
+	for ( auto & v : values )
+	{
+		if ( v >= 0 )
+		{
+			v /= repetitions;
+		}
+	}
+
+	double ns = std::chrono::duration_cast< std::chrono::nanoseconds >( end - begin ).count();
+	return Stage{ name, values, ns / repetitions, expressions, bytes };
+}
+
+/**
+ * @brief      Imprime uma tabela normalizada pelo divisor escolhido
+ */
+void report( const PerfCounters & perf, const std::vector< Stage > & stages, bool per_byte )
+{
+	std::cout << ( per_byte ? "\nPer input byte\n" : "\nPer expression\n" );
+	std::cout << std::setw( 18 ) << std::left << "stage" << std::right << std::setw( 14 ) << "ns";
+	for ( const auto & c : perf.list() )
+	{
+		std::cout << std::setw( 15 ) << c.name;
+	}
+	std::cout << "\n";
+
+	for ( const auto & s : stages )
+	{
+		double div = per_byte ? s.bytes : s.expressions;
+		if ( div == 0 )
+		{
+			div = 1;
+		}
+
+		std::cout << std::setw( 18 ) << std::left << s.name << std::right << std::fixed << std::setprecision( 3 )
+		          << std::setw( 14 ) << s.ns / div;
+		for ( auto v : s.values )
+		{
+			if ( v < 0 )
+			{
+				std::cout << std::setw( 15 ) << "n/a";
+			}
+			else
+			{
+				std::cout << std::setw( 15 ) << v / div;
+			}
+		}
+		std::cout << "\n";
+	}
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0 se o arquivo foi lido, 1 caso contrário
+ */
+int main( int argc, char const *argv[] )
+{
+	if ( argc < 2 )
+	{
+		std::cerr << "Uso: " << argv[0] << " arquivo_entrada [repeticoes]\n";
+		return 1;
+	}
+
+	std::ifstream file( argv[1] );
+	if ( not file )
+	{
+		std::cerr << "perf_profile: cannot open " << argv[1] << "\n";
+		return 1;
+	}
+
+	std::size_t repetitions = argc > 2 ? std::strtoul( argv[2], nullptr, 10 ) : 10;
+	if ( repetitions == 0 )
+	{
+		repetitions = 1;
+	}
+
+	std::vector< std::string > corpus;
+	std::string line;
+	std::size_t corpus_bytes = 0;
+	while ( std::getline( file, line ) )
+	{
+		corpus_bytes += line.size();
+		corpus.push_back( line );
+	}
+
+	// Uma passada sem medir separa as expressões válidas e aquece os caches
+	Parser parser;
+	Evaluator evaluator;
+	std::vector< std::vector< Token > > infix;
+	std::vector< std::vector< Token > > postfix;
+	std::size_t valid_bytes = 0;
+
+	for ( const auto & expr : corpus )
+	{
+		if ( parser.parse( expr ).type == Parser::ParserResult::PARSER_OK )
+		{
+			infix.push_back( parser.get_tokens() );
+			postfix.push_back( evaluator.infix_to_postfix( infix.back() ) );
+			valid_bytes += expr.size();
+		}
+	}
+
+	PerfCounters perf;
+	std::vector< Stage > stages;
+	long sink = 0;
+
+	stages.push_back( measure( perf, "parse", corpus.size(), corpus_bytes, repetitions, [&]()
+	{
+		for ( const auto & expr : corpus )
+		{
+			sink += parser.parse( expr ).type;
+		}
+	} ) );
+
+	stages.push_back( measure( perf, "infix_to_postfix", infix.size(), valid_bytes, repetitions, [&]()
+	{
+		for ( const auto & tokens : infix )
+		{
+			sink += evaluator.infix_to_postfix( tokens ).size();
+		}
+	} ) );
+
+	stages.push_back( measure( perf, "evaluate_postfix", postfix.size(), valid_bytes, repetitions, [&]()
+	{
+		for ( const auto & tokens : postfix )
+		{
+			sink += evaluator.evaluate_postfix( tokens ).value;
+		}
+	} ) );
+
+	std::cout << "corpus: " << corpus.size() << " expressions (" << infix.size() << " valid), "
+	          << corpus_bytes << " bytes, " << repetitions << " repetitions\n";
+
+	for ( const auto & c : perf.list() )
+	{
+		if ( c.fd < 0 )
+		{
+			std::cout << "counter " << c.name << " unavailable: " << std::strerror( c.error ) << "\n";
+		}
+	}
+
+	report( perf, stages, false );
+	report( perf, stages, true );
+
+	std::cout << "\n(checksum " << sink << ")\n";
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file aggregate.hpp
+ * @brief      Declaração dos métodos e atributos da classe Aggregate
+ * @details    Redução dos resultados de um lote ( "bares --aggregate" ) sem
+ *             escrever cada linha: soma, mínimo, máximo, quantidade por código
+ *             de resultado e histograma dos valores. Cada thread acumula um
+ *             Aggregate parcial e os parciais são combinados com merge() no
+ *             fim. A soma usa um acumulador de 128 bits, então não transborda
+ *             com nenhuma quantidade realista de linhas.
+ *
+ *             O histograma agrupa os valores por ordem de grandeza: uma faixa
+ *             para o zero e, para cada sinal, uma faixa [ 2^k, 2^(k+1) - 1 ]
+ *             por expoente k.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _AGGREGATE_H_
+#define _AGGREGATE_H_
+
+#include <cstdint>  	// std::uint64_t
+#include <ostream>  	// std::ostream
+#include <string>   	// std::string
+
+#include "engine.hpp"   	// Engine::Result, Engine::CACHE_LINE
+
+/**
+ * @brief      Acumulador dos resultados de um lote
+ */
+class alignas( Engine::CACHE_LINE ) Aggregate
+{
+	public:
+
+		__extension__ typedef __int128 wide_type;	// Acumulador da soma
+		using value_type = Evaluator::value_type;
+
+		/**
+		 * @brief      Redutores que podem ser exibidos
+		 */
+		enum reducer_t : unsigned
+		{
+			SUM = 1,
+			MIN = 2,
+			MAX = 4,
+			COUNT = 8,
+			HISTOGRAM = 16,
+			ALL = 31
+		};
+
+		static constexpr int PARSER_CODES = 7;    // ParserResult::code_t
+		static constexpr int EVALUATOR_CODES = 3; // EvaluatorResult::code_t
+		static constexpr int MAGNITUDES = 64;     // Expoentes possíveis de um valor
+		static constexpr int BUCKETS = 2 * MAGNITUDES + 1;
+
+	private:
+
+		std::uint64_t lines = 0;
+		std::uint64_t values = 0;            // Linhas com valor
+		wide_type sum = 0;
+		value_type min = 0;
+		value_type max = 0;
+		std::uint64_t parser_errors[ PARSER_CODES ] = {};
+		std::uint64_t evaluator_errors[ EVALUATOR_CODES ] = {};
+		std::uint64_t histogram[ BUCKETS ] = {};
+
+		/**
+		 * @brief      Faixa do histograma de um valor
+		 *
+		 * @param[in]  v     O valor
+		 *
+		 * @return     Índice da faixa: negativos primeiro, depois o zero e os
+		 *             positivos
+		 */
+		static int bucket_of( value_type v );
+
+	public:
+
+		/**
+		 * @brief      Acumula o resultado de uma linha
+		 *
+		 * @param[in]  r     O resultado
+		 */
+		void add( const Engine::Result & r );
+
+		/**
+		 * @brief      Combina outro parcial com este
+		 *
+		 * @param[in]  other  O outro parcial
+		 */
+		void merge( const Aggregate & other );
+
+		/**
+		 * @brief      Escreve os redutores pedidos, um por linha
+		 *
+		 * @param      os        Onde escrever
+		 * @param[in]  reducers  Combinação de reducer_t
+		 */
+		void write( std::ostream & os, unsigned reducers ) const;
+
+		/**
+		 * @brief      Converte uma lista como "sum,max,histogram" ( ou "all" )
+		 *             em redutores
+		 *
+		 * @param[in]  list      A lista, separada por vírgulas
+		 * @param[out] reducers  Combinação de reducer_t
+		 *
+		 * @return     False se algum nome é desconhecido
+		 */
+		static bool parse_reducers( const std::string & list, unsigned & reducers );
+};
+
+#endif
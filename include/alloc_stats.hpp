@@ -0,0 +1,96 @@
+/**
+ * @file alloc_stats.hpp
+ * @brief      Contabilidade de alocações e de memória do bares
+ * @details    Ligada apenas se o bares for compilado com BARES_ALLOC_STATS (
+ *             "make ALLOC_STATS=1" ). Nesse caso os operadores new e delete
+ *             globais são substituídos por versões que contam as alocações e
+ *             os bytes pedidos, separados pela etapa em que a thread está (
+ *             leitura, Parser, conversão para posfixa, avaliação, saída ), e
+ *             acompanham o pico de memória em uso. O Parser registra o maior
+ *             número de tokens de uma expressão e a jv::stack a maior altura
+ *             alcançada. No fim o relatório vai para a saída de erro, com os
+ *             números por linha e o pico de RSS do processo.
+ *
+ *             Sem BARES_ALLOC_STATS as macros abaixo não geram código algum e
+ *             os operadores new e delete são os da biblioteca padrão.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _ALLOC_STATS_H_
+#define _ALLOC_STATS_H_
+
+#if defined( BARES_ALLOC_STATS )
+
+#include <cstddef>  	// std::size_t
+#include <ostream>  	// std::ostream
+
+namespace alloc_stats
+{
+	/**
+	 * @brief      Etapas às quais as alocações são atribuídas
+	 */
+	enum stage_t
+	{
+		OTHER = 0,
+		INPUT,
+		PARSE,
+		POSTFIX,
+		EVALUATE,
+		OUTPUT,
+		STAGE_COUNT
+	};
+
+	/**
+	 * @brief      Muda a etapa da thread atual
+	 *
+	 * @param[in]  stage  A nova etapa
+	 */
+	void set_stage( stage_t stage );
+
+	/**
+	 * @brief      Registra a quantidade de tokens de uma expressão
+	 *
+	 * @param[in]  n     Tokens
+	 */
+	void note_tokens( std::size_t n );
+
+	/**
+	 * @brief      Registra a altura de uma jv::stack
+	 *
+	 * @param[in]  n     Elementos na pilha
+	 */
+	void note_stack( std::size_t n );
+
+	/**
+	 * @brief      Encerra uma linha, para os números por linha
+	 */
+	void end_line( void );
+
+	/**
+	 * @brief      Escreve o relatório
+	 *
+	 * @param      os    Onde escrever
+	 */
+	void report( std::ostream & os );
+}
+
+#define BARES_ALLOC_STAGE( stage ) alloc_stats::set_stage( alloc_stats::stage )
+#define BARES_ALLOC_TOKENS( n ) alloc_stats::note_tokens( n )
+#define BARES_ALLOC_STACK( n ) alloc_stats::note_stack( n )
+#define BARES_ALLOC_LINE() alloc_stats::end_line()
+#define BARES_ALLOC_REPORT( os ) alloc_stats::report( os )
+
+#else
+
+#define BARES_ALLOC_STAGE( stage )
+#define BARES_ALLOC_TOKENS( n )
+#define BARES_ALLOC_STACK( n )
+#define BARES_ALLOC_LINE()
+#define BARES_ALLOC_REPORT( os )
+
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file bares.h
+ * @brief      API C estável da libbares
+ * @details    Permite avaliar expressões BARES sem iniciar o executável bares.
+ *             As funções são reentrantes: não há estado global, cada chamada
+ *             usa seu próprio Parser e Evaluator. Os resultados são gravados em
+ *             estruturas fornecidas por quem chama.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _BARES_C_H_
+#define _BARES_C_H_
+
+#include <stddef.h> /* size_t */
+
+#if defined(__GNUC__)
+#define BARES_API __attribute__(( visibility( "default" ) ))
+#else
+#define BARES_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Versão da API; muda apenas se bares_result ou as assinaturas mudarem. */
+#define BARES_API_VERSION 1
+
+/**
+ * @brief      Origem do resultado de uma expressão
+ */
+enum bares_status
+{
+	BARES_INTERNAL_ERROR = -2,   /* Falta de memória ( ou outra falha interna ): a expressão não foi avaliada */
+	BARES_INVALID_ARGUMENT = -1, /* Ponteiro nulo recebido */
+	BARES_OK = 0,                /* Expressão avaliada, value é válido */
+	BARES_PARSER_ERROR = 1,      /* code é um Parser::ParserResult::code_t */
+	BARES_EVALUATOR_ERROR = 2    /* code é um Evaluator::EvaluatorResult::code_t */
+};
+
+/**
+ * @brief      Resultado da avaliação de uma expressão
+ */
+typedef struct bares_result
+{
+	long value;  /* Valor da expressão quando status == BARES_OK */
+	int status;  /* Um dos valores de bares_status */
+	int code;    /* Código do Parser ou do Evaluator, 0 se status == BARES_OK */
+	long column; /* Coluna ( 1-based ) do erro do Parser, 0 caso contrário */
+} bares_result;
+
+/**
+ * @brief      Informa a versão da API com a qual a biblioteca foi compilada
+ *
+ * @return     BARES_API_VERSION da biblioteca
+ */
+BARES_API int bares_api_version( void );
+
+/**
+ * @brief      Avalia uma expressão
+ *
+ * @param[in]  expr    Expressão terminada em '\0'
+ * @param[out] result  Onde gravar o resultado
+ *
+ * @return     O status gravado em result ( BARES_INTERNAL_ERROR se faltou
+ *             memória ), ou BARES_INVALID_ARGUMENT
+ */
+BARES_API int bares_eval( const char * expr, bares_result * result );
+
+/**
+ * @brief      Avalia várias expressões, reaproveitando Parser e Evaluator entre
+ *             elas e dividindo lotes grandes entre threads
+ *
+ * @param[in]  exprs    Vetor com n expressões terminadas em '\0'
+ * @param[in]  n        Quantidade de expressões
+ * @param[out] results  Vetor com espaço para n resultados, na mesma ordem
+ *
+ * @return     Quantidade de expressões avaliadas com status BARES_OK; as que
+ *             não puderam ser avaliadas por falta de memória ficam com status
+ *             BARES_INTERNAL_ERROR
+ */
+BARES_API size_t bares_eval_batch( const char * const * exprs, size_t n, bares_result * results );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
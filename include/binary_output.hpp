@@ -0,0 +1,144 @@
+/**
+ * @file binary_output.hpp
+ * @brief      Declaração dos métodos e atributos da classe BinaryWriter
+ * @details    Saída binária do bares ( "bares --binary" ), para consumidores
+ *             que transformariam o texto de volta em inteiros. Cada expressão
+ *             vira um registro de tamanho fixo com o índice da linha, a etapa
+ *             e o código do resultado ( ParserResult ou EvaluatorResult ), a
+ *             coluna do erro e o valor. O arquivo começa com um cabeçalho que
+ *             descreve o tamanho do registro, a largura dos inteiros e a ordem
+ *             dos bytes, e os registros são gravados em blocos grandes.
+ *
+ *             O "bin/bares_dump" converte o arquivo de volta no texto de
+ *             sempre.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _BINARY_OUTPUT_H_
+#define _BINARY_OUTPUT_H_
+
+#include <cstdint>  	// std::uint64_t, std::uint32_t, std::int64_t, std::uint8_t
+#include <string>   	// std::string
+
+#include "output_writer.hpp"	// OutputWriter
+#include "parser.hpp"       	// Parser::ParserResult
+#include "evaluator.hpp"    	// Evaluator::EvaluatorResult
+
+namespace binary_output
+{
+	constexpr char MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'B', 'O', '\0' };
+	constexpr std::uint32_t VERSION = 1;
+	constexpr std::uint32_t ENDIAN_MARK = 0x01020304;
+
+	/**
+	 * @brief      Etapa que produziu o resultado
+	 */
+	enum stage_t : std::uint8_t
+	{
+		OK = 0,         // Valor calculado
+		PARSER = 1,     // Erro do Parser, code é um ParserResult::code_t
+		EVALUATOR = 2   // Erro do Evaluator, code é um EvaluatorResult::code_t
+	};
+
+	/**
+	 * @brief      Início do arquivo ( 24 bytes )
+	 */
+	struct Header
+	{
+		char magic[8];                 // MAGIC
+		std::uint32_t version;         // VERSION
+		std::uint32_t record_size;     // sizeof( Record )
+		std::uint32_t value_width;     // Bytes do valor ( 8 )
+		std::uint32_t byte_order;      // ENDIAN_MARK, lido na ordem de quem gravou
+	};
+
+	/**
+	 * @brief      Resultado de uma expressão ( 24 bytes )
+	 */
+	struct Record
+	{
+		std::uint64_t line;            // Índice da linha na entrada ( a partir de 0 )
+		std::uint32_t column;          // Coluna do erro do Parser ( a partir de 0 )
+		std::uint8_t stage;            // stage_t
+		std::uint8_t code;             // Código do resultado da etapa
+		std::uint16_t reserved;
+		std::int64_t value;            // Valor, se stage é OK
+	};
+
+	/**
+	 * @brief      Confere se um cabeçalho foi gravado por esta versão, nesta
+	 *             arquitetura
+	 *
+	 * @param[in]  header  O cabeçalho
+	 *
+	 * @return     Vazio se é compatível, ou a descrição do problema
+	 */
+	std::string check( const Header & header );
+}
+
+/**
+ * @brief      Escritor dos registros binários
+ */
+class BinaryWriter
+{
+	public:
+
+		using size_type = std::size_t;
+
+		/**
+		 * @brief      Tamanho dos blocos gravados
+		 */
+		static constexpr size_type BLOCK = 1 << 20;
+
+	private:
+
+		OutputWriter out;       // Buffer e write(2) do OutputWriter
+		std::uint64_t line = 0; // Índice do próximo registro
+
+		/**
+		 * @brief      Grava um registro e avança a linha
+		 */
+		void write_record( std::uint8_t stage, std::uint8_t code, std::uint32_t column, std::int64_t value );
+
+	public:
+
+		/**
+		 * @brief      Construtor do BinaryWriter, grava o cabeçalho
+		 *
+		 * @param[in]  fd    Descritor da saída ( padrão: saída padrão )
+		 */
+		explicit BinaryWriter( int fd = 1 );
+
+		/**
+		 * @brief      Grava o valor de uma expressão
+		 *
+		 * @param[in]  value  O valor
+		 */
+		void write_value( long long value );
+
+		/**
+		 * @brief      Grava o erro do Parser
+		 *
+		 * @param[in]  result  O resultado da avaliação do Parser
+		 */
+		void write_parser_error( const Parser::ParserResult & result );
+
+		/**
+		 * @brief      Grava o erro do Evaluator
+		 *
+		 * @param[in]  result  O resultado da avaliação do Evaluator
+		 */
+		void write_evaluator_error( const Evaluator::EvaluatorResult & result );
+
+		/**
+		 * @brief      Descarrega o bloco atual
+		 *
+		 * @return     True se todas as escritas até agora deram certo
+		 */
+		bool flush( void );
+};
+
+#endif
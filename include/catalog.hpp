@@ -0,0 +1,261 @@
+/**
+ * @file catalog.hpp
+ * @brief      Declaração das classes CatalogWriter e Catalog
+ * @details    Um catálogo é um arquivo binário com várias expressões já
+ *             compiladas ( instruções de Program e seus literais ). Ele é
+ *             gravado uma vez e depois mapeado com mmap, e as expressões são
+ *             avaliadas direto das páginas mapeadas, sem Parser nem
+ *             infix_to_postfix. Expressões com erro de análise guardam o
+ *             código e a coluna do erro.
+ *
+ *             Formato ( versão 2, alinhado em 8 bytes, na ordem de bytes da
+ *             máquina que gravou ):
+ *
+ *                 Header
+ *                 Entry        [ Header::count ]
+ *                 Instruction  [ Header::instruction_count ]
+ *                 value_type   [ Header::constant_count ]
+ *
+ *             O checksum ( FNV-1a de 64 bits ) cobre tudo após o Header. A
+ *             versão 2 acrescenta o bit Instruction::UNCHECKED nas operações
+ *             provadas seguras; catálogos da versão 1 continuam legíveis. Os
+ *             códigos de operação gravados são fixos ( ver os static_assert
+ *             de Program ), não a ordem de bares::OPERATORS.
+ *
+ *             Por padrão, open() confere apenas o cabeçalho e os tamanhos, e
+ *             cada entrada é validada ( limites, códigos de operação, índices
+ *             dos literais, altura da pilha e, refazendo a análise de faixas
+ *             com os literais gravados, as operações marcadas UNCHECKED ) na
+ *             primeira vez em que é usada, então só as páginas das expressões
+ *             avaliadas são lidas. A
+ *             verificação completa ( checksum e todas as entradas ) é opcional.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _CATALOG_H_
+#define _CATALOG_H_
+
+#include <atomic>   	// std::atomic
+#include <cstdint>  	// std::uint64_t, std::uint32_t
+#include <cstddef>  	// std::size_t
+#include <memory>   	// std::unique_ptr
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "parser.hpp"   	// Parser::ParserResult
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+#include "program.hpp"  	// Program
+
+namespace catalog
+{
+	constexpr char MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'P', 'C', '\0' };
+	constexpr std::uint32_t VERSION = 2;
+	constexpr std::uint16_t ENDIANNESS = 0x0102;
+
+	/**
+	 * @brief      Cabeçalho do arquivo
+	 */
+	struct Header
+	{
+		char magic[8];                    // MAGIC
+		std::uint32_t version;            // VERSION
+		std::uint16_t value_size;         // sizeof( Evaluator::value_type )
+		std::uint16_t byte_order;         // ENDIANNESS como gravado
+		std::uint64_t count;              // Quantidade de expressões
+		std::uint64_t instruction_count;  // Total de instruções
+		std::uint64_t constant_count;     // Total de literais
+		std::uint64_t checksum;           // FNV-1a do restante do arquivo
+	};
+
+	/**
+	 * @brief      Descrição de uma expressão do catálogo
+	 */
+	struct Entry
+	{
+		std::uint64_t first_instruction;  // Índice da primeira instrução
+		std::uint64_t first_constant;     // Índice do primeiro literal ( slot 0 )
+		std::uint32_t instruction_count;  // Quantidade de instruções
+		std::uint32_t max_depth;          // Altura máxima da pilha
+		std::int32_t parser_code;         // Parser::ParserResult::code_t
+		std::int32_t reserved;            // Sempre 0
+		std::int64_t at_col;              // Coluna do erro do Parser
+	};
+
+	/**
+	 * @brief      Calcula o FNV-1a de 64 bits de um bloco de memória
+	 *
+	 * @param[in]  data  Início do bloco
+	 * @param[in]  size  Tamanho do bloco
+	 * @param[in]  hash  Valor inicial ( permite calcular em partes )
+	 *
+	 * @return     O hash
+	 */
+	std::uint64_t fnv1a( const void * data, std::size_t size, std::uint64_t hash = 14695981039346656037ull );
+}
+
+/**
+ * @brief      Monta um catálogo em memória e o grava em arquivo
+ */
+class CatalogWriter
+{
+	private:
+
+		std::vector< catalog::Entry > entries;
+		std::vector< Program::Instruction > code;
+		std::vector< Program::value_type > constants;
+
+	public:
+
+		/**
+		 * @brief      Adiciona uma expressão compilada
+		 *
+		 * @param[in]  program  A expressão compilada
+		 */
+		void add( const Program & program );
+
+		/**
+		 * @brief      Adiciona uma expressão que falhou na análise
+		 *
+		 * @param[in]  parsed  O resultado do Parser
+		 */
+		void add( const Parser::ParserResult & parsed );
+
+		/**
+		 * @brief      Informa quantas expressões foram adicionadas
+		 *
+		 * @return     Quantidade de expressões
+		 */
+		std::size_t size( void ) const;
+
+		/**
+		 * @brief      Grava o catálogo, primeiro em um arquivo temporário que
+		 *             depois é renomeado, para nunca deixar um arquivo parcial
+		 *
+		 * @param[in]  path  Caminho do arquivo
+		 *
+		 * @return     True se foi gravado, False caso contrário
+		 */
+		bool save( const std::string & path ) const;
+};
+
+/**
+ * @brief      Catálogo mapeado em memória, somente leitura
+ */
+class Catalog
+{
+	private:
+
+		const unsigned char * base = nullptr;   // Início do mapeamento
+		std::size_t length = 0;                 // Tamanho do mapeamento
+		const catalog::Header * header = nullptr;
+		const catalog::Entry * entries = nullptr;
+		const Program::Instruction * code = nullptr;
+		const Program::value_type * constants = nullptr;
+
+		/**
+		 * @brief      Estado da validação de cada entrada
+		 */
+		enum check_t : unsigned char
+		{
+			UNCHECKED = 0,
+			VALID,
+			INVALID
+		};
+
+		mutable std::unique_ptr< std::atomic< unsigned char >[] > checked; // Um check_t por entrada
+
+		/**
+		 * @brief      Desfaz o mapeamento atual
+		 */
+		void close( void );
+
+		/**
+		 * @brief      Valida os limites e as instruções de uma entrada
+		 *
+		 * @param[in]  e     A entrada
+		 *
+		 * @return     True se a entrada pode ser avaliada com segurança
+		 */
+		bool valid( const catalog::Entry & e ) const;
+
+	public:
+
+		/**
+		 * @brief      Construtor padrão ( catálogo vazio )
+		 */
+		Catalog() = default;
+
+		/**
+		 * @brief      Destrutor, desfaz o mapeamento
+		 */
+		~Catalog();
+
+		/**
+		 * @brief      Construtor cópia do Catalog deletado
+		 *
+		 * @param[in]  other  O outro Catalog
+		 */
+		Catalog( const Catalog & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro Catalog
+		 *
+		 * @return     O novo Catalog
+		 */
+		Catalog & operator=( const Catalog & other ) = delete;
+
+		/**
+		 * @brief      Mapeia o arquivo e valida o cabeçalho e os tamanhos
+		 *
+		 * @param[in]  path    Caminho do arquivo
+		 * @param[in]  verify  Se o checksum e todas as entradas devem ser
+		 *                     conferidos agora ( lê o arquivo inteiro )
+		 *
+		 * @return     Mensagem vazia se deu certo, ou a descrição do problema
+		 */
+		std::string open( const std::string & path, bool verify = false );
+
+		/**
+		 * @brief      Valida a entrada i, na primeira chamada
+		 *
+		 * @param[in]  i     Índice da expressão
+		 *
+		 * @return     Mensagem vazia se a entrada é válida, ou a descrição do
+		 *             problema
+		 */
+		std::string check( std::size_t i ) const;
+
+		/**
+		 * @brief      Informa quantas expressões o catálogo possui
+		 *
+		 * @return     Quantidade de expressões
+		 */
+		std::size_t size( void ) const;
+
+		/**
+		 * @brief      Recupera o resultado da análise da expressão i
+		 *
+		 * @param[in]  i     Índice da expressão ( validada por check() )
+		 *
+		 * @return     O ParserResult guardado
+		 */
+		Parser::ParserResult parse_result( std::size_t i ) const;
+
+		/**
+		 * @brief      Avalia a expressão i direto das páginas mapeadas
+		 *
+		 * @param[in]  i     Índice da expressão ( sem erro de análise )
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix
+		 *
+		 * @throws     std::runtime_error se a entrada não passa em check()
+		 */
+		Evaluator::EvaluatorResult evaluate( std::size_t i ) const;
+};
+
+#endif
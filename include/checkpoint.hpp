@@ -0,0 +1,101 @@
+/**
+ * @file checkpoint.hpp
+ * @brief      Declaração dos métodos e atributos da classe Checkpoint
+ * @details    Progresso de uma execução longa ( "bares --checkpoint" ): a
+ *             posição na entrada até onde as linhas já foram avaliadas e o
+ *             tamanho da saída correspondente. O arquivo tem tamanho fixo,
+ *             termina com um checksum e é substituído de forma atômica ( o
+ *             novo conteúdo é gravado ao lado, sincronizado com fsync e
+ *             renomeado por cima ), então sempre contém um progresso completo,
+ *             mesmo se o processo morre no meio da gravação.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _CHECKPOINT_H_
+#define _CHECKPOINT_H_
+
+#include <cstdint>  	// std::uint64_t, std::uint32_t, std::int64_t
+#include <string>   	// std::string
+
+namespace checkpoint
+{
+	constexpr char MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'C', 'K', '\0' };
+	constexpr std::uint32_t VERSION = 1;
+
+	/**
+	 * @brief      Progresso gravado
+	 */
+	struct State
+	{
+		std::uint64_t input_offset = 0;  // Bytes da entrada já avaliados ( sempre no início de uma linha )
+		std::uint64_t output_offset = 0; // Bytes da saída que correspondem a eles
+		std::uint64_t lines = 0;         // Linhas já avaliadas
+		std::uint64_t input_size = 0;    // Tamanho da entrada, para detectar outra entrada
+		std::int64_t input_mtime = 0;    // Modificação da entrada ( ns ), idem
+	};
+
+	/**
+	 * @brief      Conteúdo do arquivo ( 64 bytes )
+	 */
+	struct Record
+	{
+		char magic[8];                   // MAGIC
+		std::uint32_t version;           // VERSION
+		std::uint32_t reserved;
+		State state;
+		std::uint64_t checksum;          // FNV-1a dos bytes anteriores
+	};
+}
+
+/**
+ * @brief      Arquivo com o progresso de uma execução
+ */
+class Checkpoint
+{
+	private:
+
+		std::string path;
+
+		/**
+		 * @brief      Calcula o checksum de um registro
+		 */
+		static std::uint64_t checksum_of( const checkpoint::Record & r );
+
+	public:
+
+		/**
+		 * @brief      Construtor do Checkpoint
+		 *
+		 * @param[in]  path_  Caminho do arquivo
+		 */
+		explicit Checkpoint( const std::string & path_ );
+
+		/**
+		 * @brief      Lê o progresso gravado
+		 *
+		 * @param[out] state  O progresso
+		 *
+		 * @return     Vazio se leu ( state zerado se o arquivo não existe ), ou
+		 *             a descrição do erro se o arquivo é inválido
+		 */
+		std::string load( checkpoint::State & state ) const;
+
+		/**
+		 * @brief      Substitui o progresso gravado de forma atômica
+		 *
+		 * @param[in]  state  O progresso
+		 *
+		 * @return     Vazio se gravou, ou a descrição do erro
+		 */
+		std::string save( const checkpoint::State & state ) const;
+
+		/**
+		 * @brief      Apaga o arquivo ( a execução terminou )
+		 */
+		void remove( void ) const;
+};
+
+#endif
@@ -0,0 +1,247 @@
+/**
+ * @file compression.hpp
+ * @brief      Declaração dos métodos e atributos das classes LineSource e
+ *             StreamCompressor
+ * @details    Entrada e saída comprimidas sem processos externos.
+ *
+ *             O LineSource lê um descritor em uma thread própria, reconhece
+ *             pelos primeiros bytes se o conteúdo é gzip ou zstd e o
+ *             descomprime em dois buffers alternados: enquanto a thread de
+ *             avaliação separa as linhas de um, a thread de leitura enche o
+ *             outro, então a avaliação só espera se a descompressão for mais
+ *             lenta que ela. Conteúdo sem compressão passa pelo mesmo caminho,
+ *             sem cópia extra.
+ *
+ *             O StreamCompressor lê o que é escrito em um pipe e grava a versão
+ *             comprimida no descritor de destino, também em uma thread
+ *             própria.
+ *
+ *             A zlib e a zstd são usadas se o makefile as encontrar (
+ *             BARES_HAS_ZLIB e BARES_HAS_ZSTD ); sem elas, o formato
+ *             correspondente é rejeitado com uma mensagem de erro.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _COMPRESSION_H_
+#define _COMPRESSION_H_
+
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>  	// std::size_t
+#include <memory>   	// std::shared_ptr
+#include <mutex>    	// std::mutex
+#include <string>   	// std::string
+#include <thread>   	// std::thread
+#include <vector>   	// std::vector
+
+namespace compression
+{
+	/**
+	 * @brief      Formatos reconhecidos
+	 */
+	enum class format_t
+	{
+		NONE,
+		GZIP,
+		ZSTD
+	};
+
+	/**
+	 * @brief      Reconhece o formato pelos primeiros bytes
+	 *
+	 * @param[in]  data  Início do conteúdo
+	 * @param[in]  n     Bytes disponíveis
+	 *
+	 * @return     O formato ( NONE se não for comprimido )
+	 */
+	format_t detect( const unsigned char * data, std::size_t n );
+
+	/**
+	 * @brief      Informa se o formato foi incluído na compilação
+	 *
+	 * @param[in]  format  O formato
+	 *
+	 * @return     True se pode ser lido e escrito
+	 */
+	bool is_supported( format_t format );
+
+	/**
+	 * @brief      Converte um nome ( "gzip", "zstd" ) em formato
+	 *
+	 * @param[in]  name    O nome
+	 * @param[out] format  O formato
+	 *
+	 * @return     True se o nome é conhecido
+	 */
+	bool from_name( const std::string & name, format_t & format );
+}
+
+/**
+ * @brief      Linhas de um descritor, descomprimidas em outra thread
+ */
+class LineSource
+{
+	public:
+
+		using size_type = std::size_t;
+
+		/**
+		 * @brief      Tamanho de cada buffer
+		 */
+		static constexpr size_type BLOCK = 1 << 20;
+
+	private:
+
+		/**
+		 * @brief      Um dos dois buffers
+		 */
+		struct Buffer
+		{
+			std::vector< char > data;
+			size_type size = 0;     // Bytes válidos
+			bool ready = false;     // Cheio, esperando a thread de avaliação
+		};
+
+		/**
+		 * @brief      Estado dividido com a thread de leitura ( que pode
+		 *             sobreviver ao LineSource se ficar presa em um read )
+		 */
+		struct Shared
+		{
+			int fd;
+			Buffer buffers[2];
+			std::mutex lock;
+			std::condition_variable changed;
+			bool finished = false;  // A thread de leitura terminou
+			bool stopped = false;   // O LineSource foi destruído antes do fim
+			std::string error;      // Erro de leitura ou de descompressão
+		};
+
+		std::shared_ptr< Shared > shared;
+		std::thread producer;
+		size_type current = 0;  // Buffer sendo consumido
+		size_type pos = 0;      // Posição dentro dele
+		bool holding = false;   // Se o buffer atual está em uso
+		bool eof = false;       // Não há mais buffers
+
+		/**
+		 * @brief      Corpo da thread de leitura
+		 */
+		static void produce( std::shared_ptr< Shared > shared );
+
+		/**
+		 * @brief      Espera o próximo buffer cheio
+		 *
+		 * @return     False se a entrada acabou
+		 */
+		bool acquire( void );
+
+	public:
+
+		/**
+		 * @brief      Construtor do LineSource, inicia a thread de leitura
+		 *
+		 * @param[in]  fd    Descritor a ser lido ( padrão: entrada padrão )
+		 */
+		explicit LineSource( int fd = 0 );
+
+		/**
+		 * @brief      Destrutor, encerra a thread de leitura
+		 */
+		~LineSource();
+
+		/**
+		 * @brief      Construtor cópia do LineSource deletado
+		 *
+		 * @param[in]  other  O outro LineSource
+		 */
+		LineSource( const LineSource & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro LineSource
+		 *
+		 * @return     O novo LineSource
+		 */
+		LineSource & operator=( const LineSource & other ) = delete;
+
+		/**
+		 * @brief      Lê a próxima linha, como std::getline
+		 *
+		 * @param[out] line  A linha, sem o '\n'
+		 *
+		 * @return     False se a entrada acabou ( ou falhou )
+		 */
+		bool next( std::string & line );
+
+		/**
+		 * @brief      Recupera o erro de leitura, depois que next() retornou
+		 *             false
+		 *
+		 * @return     A mensagem, vazia se a entrada acabou normalmente
+		 */
+		std::string error( void ) const;
+};
+
+/**
+ * @brief      Compressão de um fluxo em outra thread
+ */
+class StreamCompressor
+{
+	private:
+
+		int in;                  // Ponta de leitura do pipe
+		int out;                 // Destino dos dados comprimidos
+		compression::format_t format;
+		std::thread worker;
+		std::string failure;     // Erro de escrita ou de compressão
+
+		/**
+		 * @brief      Corpo da thread de compressão
+		 */
+		void run( void );
+
+	public:
+
+		/**
+		 * @brief      Construtor do StreamCompressor, inicia a thread
+		 *
+		 * @param[in]  in_      Descritor de onde ler os dados ( até o fim )
+		 * @param[in]  out_     Descritor onde gravar os dados comprimidos
+		 * @param[in]  format_  GZIP ou ZSTD
+		 */
+		StreamCompressor( int in_, int out_, compression::format_t format_ );
+
+		/**
+		 * @brief      Destrutor, espera a thread terminar
+		 */
+		~StreamCompressor();
+
+		/**
+		 * @brief      Construtor cópia do StreamCompressor deletado
+		 *
+		 * @param[in]  other  O outro StreamCompressor
+		 */
+		StreamCompressor( const StreamCompressor & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro StreamCompressor
+		 *
+		 * @return     O novo StreamCompressor
+		 */
+		StreamCompressor & operator=( const StreamCompressor & other ) = delete;
+
+		/**
+		 * @brief      Espera o fim da entrada e da compressão
+		 *
+		 * @return     Vazio se tudo foi gravado, ou a descrição do erro
+		 */
+		std::string finish( void );
+};
+
+#endif
@@ -0,0 +1,533 @@
+/**
+ * @file constexpr_bares.hpp
+ * @brief      Avaliação de expressões BARES em tempo de compilação
+ * @details    Analisador léxico, sintático e avaliador constexpr que seguem a
+ *             mesma gramática do Parser ( inclusive os códigos de erro e as
+ *             colunas informadas ) e as mesmas regras de precedência do
+ *             Evaluator ( operators.hpp ). Assim
+ *
+ *                 constexpr auto v = bares::eval( "(2+3)*4" );
+ *
+ *             é calculado pelo compilador, e qualquer erro de análise ou de
+ *             avaliação se torna um erro de compilação. Em tempo de execução,
+ *             bares::eval lança std::runtime_error com a mesma mensagem que o
+ *             bares imprimiria; bares::evaluate nunca lança e devolve o código.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _CONSTEXPR_BARES_H_
+#define _CONSTEXPR_BARES_H_
+
+#include <cstddef>  	// std::size_t, std::ptrdiff_t
+#include <limits>   	// std::numeric_limits
+#include <stdexcept>	// std::runtime_error
+#include <string>   	// std::to_string
+
+#include "parser.hpp"   	// Parser::ParserResult, Parser::required_int_type
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+#include "operators.hpp"	// bares::OPERATORS, bares::precedence, bares::has_higher_precedence
+
+namespace bares
+{
+	using value_type = Evaluator::value_type;
+	using parser_code = Parser::ParserResult::code_t;
+	using evaluator_code = Evaluator::EvaluatorResult::code_t;
+
+	/**
+	 * @brief      Resultado da avaliação em tempo de compilação
+	 */
+	struct result
+	{
+		value_type value;       // Valor da expressão
+		parser_code parser;     // Resultado do Parser
+		evaluator_code evaluator; // Resultado do Evaluator
+		std::ptrdiff_t at_col;  // Coluna ( 0-based ) do erro do Parser
+	};
+
+	namespace detail
+	{
+		constexpr value_type MAX = std::numeric_limits< Parser::required_int_type >::max();
+		constexpr value_type MIN = std::numeric_limits< Parser::required_int_type >::min();
+
+		/**
+		 * @brief      Resultado parcial da análise, como Parser::ParserResult
+		 */
+		struct status
+		{
+			parser_code type;
+			std::ptrdiff_t at_col;
+		};
+
+		/**
+		 * @brief      Resultado de uma operação, como Evaluator::EvaluatorResult
+		 */
+		struct value_code
+		{
+			value_type value;
+			evaluator_code type;
+		};
+
+		/**
+		 * @brief      Exponenciação inteira equivalente à conversão de
+		 *             std::pow( term1, term2 ) feita por
+		 *             Evaluator::execute_operator
+		 *
+		 * @param[in]  term1  Base
+		 * @param[in]  term2  Expoente
+		 * @param      overflow  Marcado se o resultado sai da faixa
+		 *
+		 * @return     O valor de term1 ^ term2 truncado para inteiro
+		 */
+		constexpr value_type power( value_type term1, value_type term2, bool & overflow )
+		{
+			if ( term2 == 0 )
+			{
+				return 1;
+			}
+			if ( term2 < 0 )
+			{
+				// 1 / term1^|term2| é truncado para 0, exceto para |term1| <= 1
+				if ( term1 == 0 )
+				{
+					overflow = true; // pow( 0, -n ) é infinito
+					return 0;
+				}
+				if ( term1 == 1 )
+				{
+					return 1;
+				}
+				if ( term1 == -1 )
+				{
+					return term2 % 2 == 0 ? 1 : -1;
+				}
+				return 0;
+			}
+
+			value_type r = 1;
+			for ( value_type i = 0; i < term2; ++i )
+			{
+				r *= term1;
+				if ( r > MAX or r < MIN )
+				{
+					overflow = true;
+					return 0;
+				}
+			}
+			return r;
+		}
+
+		/**
+		 * @brief      Executa uma operação com a mesma semântica de
+		 *             Evaluator::execute_operator
+		 *
+		 * @param[in]  term1  Primeiro termo
+		 * @param[in]  term2  Segundo termo
+		 * @param[in]  op     Símbolo do operador
+		 *
+		 * @return     O valor e o código da operação
+		 */
+		constexpr value_code execute_operator( value_type term1, value_type term2, char op )
+		{
+			bool overflow = false;
+			value_type r = 0;
+
+			// As funções da tabela não são constexpr: só o teste do divisor
+			// vem dela, o cálculo é refeito aqui
+			if ( is_operator( op ) and OPERATORS[ operator_index( op ) ].checks_divisor and term2 == 0 )
+			{
+				return value_code{ 0, evaluator_code::DIVISION_BY_ZERO };
+			}
+
+			switch ( op )
+			{
+				case '+': r = term1 + term2; break;
+				case '-': r = term1 - term2; break;
+				case '*': r = term1 * term2; break;
+				case '/': r = term1 / term2; break;
+				case '%': r = term1 % term2; break;
+				case '^': r = power( term1, term2, overflow ); break;
+			}
+
+			if ( overflow or r > MAX or r < MIN )
+			{
+				return value_code{ 0, evaluator_code::NUMERIC_OVERFLOW };
+			}
+
+			return value_code{ r, evaluator_code::RESULT_OK };
+		}
+
+		/**
+		 * @brief      Analisador descendente recursivo idêntico ao Parser, que
+		 *             guarda os tokens em vetores de tamanho fixo
+		 *
+		 * @tparam     N     Capacidade ( tamanho do literal )
+		 */
+		template < std::size_t N >
+		class machine
+		{
+			private:
+
+				const char * expr;  // Expressão a ser avaliada
+				std::size_t len;    // Tamanho da expressão
+				std::size_t pos;    // Símbolo atual
+
+				char kinds[ N ];        // Tipo de cada token: 'n', '(', ')' ou o operador
+				value_type values[ N ]; // Valor dos operandos
+				std::size_t count;      // Quantidade de tokens
+
+				constexpr bool end_input( void ) const { return pos >= len; }
+
+				constexpr char curr( void ) const { return expr[ pos ]; }
+
+				constexpr bool is_ws( char c ) const { return c == ' ' or c == 9; }
+
+				constexpr bool is_digit( char c ) const { return c >= '0' and c <= '9'; }
+
+				constexpr std::ptrdiff_t col( void ) const { return static_cast< std::ptrdiff_t >( pos ); }
+
+				constexpr void push( char kind, value_type v = 0 )
+				{
+					kinds[ count ] = kind;
+					values[ count ] = v;
+					++count;
+				}
+
+				constexpr void skip_ws( void )
+				{
+					while ( not end_input() and is_ws( curr() ) )
+					{
+						++pos;
+					}
+				}
+
+				constexpr bool accept( char c )
+				{
+					if ( not end_input() and curr() == c )
+					{
+						++pos;
+						return true;
+					}
+					return false;
+				}
+
+				constexpr bool expect( char c )
+				{
+					skip_ws();
+					return accept( c );
+				}
+
+				constexpr status natural_number( void )
+				{
+					if ( end_input() or not is_digit( curr() ) or curr() == '0' )
+					{
+						return status{ parser_code::ILL_FORMED_INTEGER, col() };
+					}
+					while ( not end_input() and is_digit( curr() ) )
+					{
+						++pos;
+					}
+					return status{ parser_code::PARSER_OK, 0 };
+				}
+
+				constexpr status integer( void )
+				{
+					auto begin_token = pos;
+
+					if ( accept( '0' ) )
+					{
+						push( 'n', 0 );
+						return status{ parser_code::PARSER_OK, 0 };
+					}
+
+					auto cont = 0;
+					while ( accept( '-' ) )
+					{
+						++cont;
+					}
+
+					auto begin_number = pos;
+					auto result = natural_number();
+
+					if ( result.type == parser_code::PARSER_OK )
+					{
+						// Satura acima da faixa, o Parser rejeita da mesma forma
+						value_type v = 0;
+						for ( auto i = begin_number; i < pos; ++i )
+						{
+							v = v > MAX ? v : v * 10 + ( expr[ i ] - '0' );
+						}
+						if ( cont % 2 == 1 )
+						{
+							v = -v;
+						}
+						if ( v >= MAX or v <= MIN )
+						{
+							return status{ parser_code::INTEGER_OUT_OF_RANGE, static_cast< std::ptrdiff_t >( begin_token ) };
+						}
+						push( 'n', v );
+					}
+					else if ( not end_input() )
+					{
+						return status{ parser_code::ILL_FORMED_INTEGER, static_cast< std::ptrdiff_t >( begin_token ) };
+					}
+					else
+					{
+						return status{ parser_code::UNEXPECTED_END_OF_EXPRESSION, col() };
+					}
+
+					return result;
+				}
+
+				constexpr status term( void )
+				{
+					skip_ws();
+
+					status result{ parser_code::MISSING_TERM, col() };
+
+					if ( expect( '(' ) )
+					{
+						push( '(' );
+						result = expression();
+
+						if ( result.type == parser_code::PARSER_OK )
+						{
+							if ( not expect( ')' ) )
+							{
+								return status{ parser_code::MISSING_CLOSING_PARENTHESIS, col() };
+							}
+							push( ')' );
+						}
+					}
+					else
+					{
+						result = integer();
+					}
+
+					return result;
+				}
+
+				constexpr status expression( void )
+				{
+					skip_ws();
+
+					status result = term();
+
+					while ( result.type == parser_code::PARSER_OK )
+					{
+						skip_ws();
+
+						// Mesma ordem de tentativa de Parser::expression()
+						if ( end_input() or precedence( curr() ) == 0 )
+						{
+							return result;
+						}
+						push( curr() );
+						++pos;
+
+						result = term();
+						if ( result.type != parser_code::PARSER_OK
+							and result.type != parser_code::INTEGER_OUT_OF_RANGE and end_input() )
+						{
+							result.type = parser_code::MISSING_TERM;
+							return result;
+						}
+					}
+
+					return result;
+				}
+
+			public:
+
+				constexpr machine( const char * e, std::size_t l )
+					: expr( e ), len( l ), pos( 0 ), kinds{}, values{}, count( 0 )
+				{ /* Vazio */ }
+
+				/**
+				 * @brief      Equivalente a Parser::parse
+				 */
+				constexpr status parse( void )
+				{
+					skip_ws();
+					if ( end_input() )
+					{
+						return status{ parser_code::UNEXPECTED_END_OF_EXPRESSION, col() };
+					}
+
+					auto result = expression();
+
+					if ( result.type == parser_code::PARSER_OK )
+					{
+						skip_ws();
+						if ( not end_input() )
+						{
+							return status{ parser_code::EXTRANEOUS_SYMBOL, col() };
+						}
+					}
+					return result;
+				}
+
+				/**
+				 * @brief      Equivalente a infix_to_postfix seguido de
+				 *             evaluate_postfix, sobre os tokens já analisados
+				 */
+				constexpr value_code evaluate( void ) const
+				{
+					char ops[ N ] = {};
+					std::size_t n_ops = 0;
+					value_type st[ N ] = {};
+					std::size_t n_st = 0;
+					value_code result{ 0, evaluator_code::RESULT_OK };
+
+					for ( std::size_t i = 0; i <= count; ++i )
+					{
+						char k = i < count ? kinds[ i ] : ')';
+
+						if ( k == 'n' )
+						{
+							st[ n_st++ ] = values[ i ];
+						}
+						else if ( k == '(' )
+						{
+							ops[ n_ops++ ] = k;
+						}
+						else
+						{
+							// Desempilha enquanto o topo tiver prioridade; ao
+							// fechar escopo ( ou no fim ) desempilha até o "("
+							while ( n_ops > 0 and ops[ n_ops - 1 ] != '('
+								and ( k == ')' or has_higher_precedence( ops[ n_ops - 1 ], k ) ) )
+							{
+								auto term2 = st[ --n_st ];
+								auto term1 = st[ --n_st ];
+								result = execute_operator( term1, term2, ops[ --n_ops ] );
+								st[ n_st++ ] = result.value;
+							}
+
+							if ( k == ')' )
+							{
+								if ( n_ops > 0 )
+								{
+									--n_ops;
+								}
+							}
+							else
+							{
+								ops[ n_ops++ ] = k;
+							}
+						}
+					}
+
+					result.value = st[ 0 ];
+					return result;
+				}
+		};
+
+		// Funções não-constexpr: se alcançadas durante uma avaliação em tempo de
+		// compilação o compilador aponta o nome do erro.
+
+		inline void unexpected_end_of_expression( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Unexpected end of input at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void ill_formed_integer( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Ill formed integer at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void missing_term( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Missing <term> at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void extraneous_symbol( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Extraneous symbol after valid expression found at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void missing_closing_parenthesis( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Missing closing \")\" at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void integer_out_of_range( std::ptrdiff_t col )
+		{
+			throw std::runtime_error( "Integer constant out of range beginning at column (" + std::to_string( col + 1 ) + ")!" );
+		}
+
+		inline void division_by_zero( void )
+		{
+			throw std::runtime_error( "Division by zero!" );
+		}
+
+		inline void numeric_overflow( void )
+		{
+			throw std::runtime_error( "Numeric overflow error!" );
+		}
+	}
+
+	/**
+	 * @brief      Avalia a expressão sem lançar exceções
+	 *
+	 * @param[in]  e_    Expressão ( literal de string )
+	 *
+	 * @tparam     N     Tamanho do literal, incluindo o '\0'
+	 *
+	 * @return     O valor e os códigos do Parser e do Evaluator
+	 */
+	template < std::size_t N >
+	constexpr result evaluate( const char ( &e_ )[ N ] )
+	{
+		detail::machine< N + 1 > m( e_, N - 1 );
+
+		auto parsed = m.parse();
+		if ( parsed.type != parser_code::PARSER_OK )
+		{
+			return result{ 0, parsed.type, evaluator_code::RESULT_OK, parsed.at_col };
+		}
+
+		auto evaluated = m.evaluate();
+		return result{ evaluated.value, parser_code::PARSER_OK, evaluated.type, 0 };
+	}
+
+	/**
+	 * @brief      Avalia a expressão; em um contexto constexpr qualquer erro
+	 *             vira erro de compilação
+	 *
+	 * @param[in]  e_    Expressão ( literal de string )
+	 *
+	 * @tparam     N     Tamanho do literal, incluindo o '\0'
+	 *
+	 * @return     O valor da expressão
+	 */
+	template < std::size_t N >
+	constexpr value_type eval( const char ( &e_ )[ N ] )
+	{
+		auto r = evaluate( e_ );
+
+		switch ( r.parser )
+		{
+			case parser_code::PARSER_OK: break;
+			case parser_code::UNEXPECTED_END_OF_EXPRESSION: detail::unexpected_end_of_expression( r.at_col ); break;
+			case parser_code::ILL_FORMED_INTEGER: detail::ill_formed_integer( r.at_col ); break;
+			case parser_code::MISSING_TERM: detail::missing_term( r.at_col ); break;
+			case parser_code::EXTRANEOUS_SYMBOL: detail::extraneous_symbol( r.at_col ); break;
+			case parser_code::MISSING_CLOSING_PARENTHESIS: detail::missing_closing_parenthesis( r.at_col ); break;
+			case parser_code::INTEGER_OUT_OF_RANGE: detail::integer_out_of_range( r.at_col ); break;
+		}
+
+		switch ( r.evaluator )
+		{
+			case evaluator_code::RESULT_OK: break;
+			case evaluator_code::DIVISION_BY_ZERO: detail::division_by_zero(); break;
+			case evaluator_code::NUMERIC_OVERFLOW: detail::numeric_overflow(); break;
+		}
+
+		return r.value;
+	}
+}
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * @file engine.hpp
+ * @brief      Declaração dos métodos e atributos da classe Engine
+ * @details    Ponto de entrada reentrante para avaliar expressões a partir de
+ *             várias threads. O Parser e o Evaluator guardam o estado de cada
+ *             chamada em atributos e não podem ser copiados, então não podem
+ *             ser compartilhados. O Engine não tem estado mutável: todo o
+ *             espaço de trabalho fica em um Engine::Context, passado a cada
+ *             chamada ou, por padrão, um por thread ( thread_local ). Um único
+ *             Engine const pode ser usado por qualquer número de threads.
+ *
+ *             Cada Context ocupa linhas de cache próprias ( alignas ), então
+ *             contextos vizinhos em um vetor não disputam a mesma linha.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _ENGINE_H_
+#define _ENGINE_H_
+
+#include <cstddef>  	// std::size_t
+#include <string>   	// std::string
+
+#include "parser.hpp"   	// Parser
+#include "evaluator.hpp"	// Evaluator
+
+/**
+ * @brief      Avaliador de expressões sem estado, compartilhável entre threads
+ */
+class Engine
+{
+	public:
+
+		/**
+		 * @brief      Tamanho da linha de cache usado para separar os contextos
+		 */
+		static constexpr std::size_t CACHE_LINE = 64;
+
+		/**
+		 * @brief      Resultado de uma expressão
+		 */
+		struct Result
+		{
+			Parser::ParserResult parsed;          // Resultado da análise
+			Evaluator::EvaluatorResult evaluated; // Resultado da avaliação, se parsed for PARSER_OK
+		};
+
+		/**
+		 * @brief      Espaço de trabalho de uma chamada; cada thread usa o seu
+		 */
+		class alignas( CACHE_LINE ) Context
+		{
+			friend class Engine;
+
+			private:
+
+				Parser parser;
+				Evaluator evaluator;
+		};
+
+		/**
+		 * @brief      Construtor padrão do Engine
+		 */
+		Engine() = default;
+
+		/**
+		 * @brief      Avalia uma expressão usando o contexto informado
+		 *
+		 * @param[in]  expr  A expressão
+		 * @param      ctx   Contexto exclusivo de quem chama durante a chamada
+		 *
+		 * @return     Os mesmos resultados de Parser::parse e
+		 *             Evaluator::evaluate_postfix
+		 */
+		Result evaluate( const std::string & expr, Context & ctx ) const;
+
+		/**
+		 * @brief      Avalia uma expressão usando o contexto da thread atual
+		 *
+		 * @param[in]  expr  A expressão
+		 *
+		 * @return     Os mesmos resultados de Parser::parse e
+		 *             Evaluator::evaluate_postfix
+		 */
+		Result evaluate( const std::string & expr ) const;
+
+		/**
+		 * @brief      Recupera o contexto da thread atual, criado no primeiro
+		 *             uso
+		 *
+		 * @return     O contexto
+		 */
+		static Context & local_context( void );
+};
+
+#endif
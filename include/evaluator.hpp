@@ -30,9 +30,9 @@
  */
 class Evaluator
 {
-	using value_type = long int;
-
 	public:
+
+	using value_type = long int;	// O tipo dos valores calculados
 	
 	/**
 	 * @brief      Struct que guarda o valor da avalização e um código que
@@ -143,19 +143,6 @@ class Evaluator
 		 */
 		bool has_higher_precedence ( Token op1, Token op2 );
 
-		/**
-		 * @brief      Executa a operação entre os dois valores informados com a
-		 *             operação indicada pelo token
-		 *
-		 * @param[in]  term1  Primeiro termo
-		 * @param[in]  term2  Segundo termo
-		 * @param[in]  op     Token que representa a operação
-		 *
-		 * @return     Retorna um EvaluatorResult, com o valor da operação e
-		 *             caso tenha ocorrido um erro qual foi.
-		 */
-		Evaluator::EvaluatorResult execute_operator ( value_type term1, value_type term2, char op );
-
 
 	public:
 
@@ -204,6 +191,20 @@ class Evaluator
 		 */
 		Evaluator::EvaluatorResult evaluate_postfix ( std::vector< Token > postfix );
 
+		/**
+		 * @brief      Executa a operação entre os dois valores informados com a
+		 *             operação indicada pelo token
+		 *
+		 * @param[in]  term1  Primeiro termo
+		 * @param[in]  term2  Segundo termo
+		 * @param[in]  op     Token que representa a operação ( um dos símbolos
+		 *                    de bares::OPERATORS )
+		 *
+		 * @return     Retorna um EvaluatorResult, com o valor da operação e
+		 *             caso tenha ocorrido um erro qual foi.
+		 */
+		static Evaluator::EvaluatorResult execute_operator ( value_type term1, value_type term2, char op );
+
 };
 
 #endif
\ No newline at end of file
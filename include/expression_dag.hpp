@@ -0,0 +1,156 @@
+/**
+ * @file expression_dag.hpp
+ * @brief      Declaração dos métodos e atributos da classe ExpressionDag
+ * @details    Avaliação em lote com subexpressões compartilhadas. Todas as
+ *             linhas do lote são convertidas em um único grafo acíclico em que
+ *             subárvores estruturalmente iguais ( mesmo operador e mesmos
+ *             filhos, ou o mesmo valor literal ) são um único nó ( hash
+ *             consing ). Como os filhos sempre são criados antes dos pais, os
+ *             nós ficam em ordem topológica e cada um é avaliado uma única vez,
+ *             em uma passada pelo vetor. O resultado de cada linha é lido do
+ *             seu nó raiz.
+ *
+ *             O valor e o código de um nó dependem apenas do operador e dos
+ *             valores dos filhos, como em Evaluator::evaluate_postfix ( uma
+ *             operação com erro empilha 0 e o código final é o do último
+ *             operador, que é a raiz ), então compartilhar nós não altera
+ *             nenhum resultado.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _EXPRESSION_DAG_H_
+#define _EXPRESSION_DAG_H_
+
+#include <cstddef>  	// std::size_t
+#include <string>   	// std::string
+#include <unordered_map>	// std::unordered_map
+#include <vector>   	// std::vector
+
+#include "token.hpp"    	// Token
+#include "parser.hpp"   	// Parser
+#include "evaluator.hpp"	// Evaluator
+
+/**
+ * @brief      Grafo de subexpressões compartilhado por um lote de linhas
+ */
+class ExpressionDag
+{
+	public:
+
+		using size_type = std::size_t;
+		using value_type = Evaluator::value_type;
+		using code_t = Evaluator::EvaluatorResult::code_t;
+
+		static constexpr size_type NIL = static_cast< size_type >( -1 );
+
+		/**
+		 * @brief      Resultado de uma linha do lote
+		 */
+		struct LineResult
+		{
+			Parser::ParserResult parsed;          // Resultado da análise
+			Evaluator::EvaluatorResult evaluated; // Resultado da avaliação, se parsed for PARSER_OK
+		};
+
+	private:
+
+		/**
+		 * @brief      Nó do grafo, folhas são literais ( op == 0 )
+		 */
+		struct Node
+		{
+			char op;            // Operador, ou 0 para literais
+			size_type left;     // Índice do filho esquerdo ( valor, nas folhas )
+			size_type right;    // Índice do filho direito
+			value_type value;   // Valor da subexpressão
+			code_t type;        // Código do operador do nó
+		};
+
+		/**
+		 * @brief      Identidade estrutural de um nó
+		 */
+		struct Key
+		{
+			char op;
+			size_type left;
+			size_type right;
+
+			bool operator==( const Key & other ) const
+			{
+				return op == other.op and left == other.left and right == other.right;
+			}
+		};
+
+		/**
+		 * @brief      Hash da identidade estrutural
+		 */
+		struct KeyHash
+		{
+			size_type operator()( const Key & k ) const;
+		};
+
+		Parser parser;
+		Evaluator evaluator;
+
+		std::vector< Node > nodes;                             // Nós únicos, filhos antes dos pais
+		std::unordered_map< Key, size_type, KeyHash > unique;  // Identidade -> índice do nó
+		size_type operators = 0;                               // Operadores em todas as linhas
+
+		/**
+		 * @brief      Procura o nó com a identidade informada, criando-o se
+		 *             ainda não existe
+		 *
+		 * @param[in]  key   A identidade
+		 *
+		 * @return     Índice do nó
+		 */
+		size_type intern( const Key & key );
+
+		/**
+		 * @brief      Acrescenta ao grafo a expressão posfixa de uma linha
+		 *
+		 * @param[in]  postfix  Expressão em notação posfixa
+		 *
+		 * @return     Índice do nó raiz, ou NIL se a expressão é vazia
+		 */
+		size_type insert( const std::vector< Token > & postfix );
+
+	public:
+
+		/**
+		 * @brief      Avalia um lote de expressões
+		 *
+		 * @param[in]  lines  As expressões, uma por linha
+		 *
+		 * @return     Um resultado por linha, na ordem da entrada, iguais aos de
+		 *             Parser::parse e Evaluator::evaluate_postfix
+		 */
+		std::vector< LineResult > evaluate( const std::vector< std::string > & lines );
+
+		/**
+		 * @brief      Informa quantos nós únicos o último lote formou
+		 *
+		 * @return     Quantidade de nós ( literais e operadores )
+		 */
+		size_type node_count( void ) const;
+
+		/**
+		 * @brief      Informa quantas operações o último lote teria sem o
+		 *             compartilhamento
+		 *
+		 * @return     Soma da quantidade de operadores de cada linha
+		 */
+		size_type operator_count( void ) const;
+
+		/**
+		 * @brief      Informa quantas operações o último lote de fato executou
+		 *
+		 * @return     Quantidade de nós de operador únicos
+		 */
+		size_type evaluated_count( void ) const;
+};
+
+#endif
@@ -0,0 +1,221 @@
+/**
+ * @file expression_tree.hpp
+ * @brief      Declaração dos métodos e atributos da classe ExpressionTree
+ * @details    Constrói uma árvore persistente a partir da expressão posfixa,
+ *             guardando o valor de cada subárvore. Ao trocar um literal apenas
+ *             o caminho entre a folha alterada e a raiz é recalculado.
+ *
+ *             O Parser gera árvores que descem pela esquerda ( "1+2+3" é
+ *             "(1+2)+3" ), então esse caminho teria o tamanho da expressão.
+ *             Por isso cada descida pela esquerda vira uma cadeia: o literal
+ *             do início seguido das operações, cada uma com o valor do seu
+ *             termo direito, guardadas em uma árvore de segmentos. Cada
+ *             segmento só de "+", "-" e "*" guarda a função linear que ele
+ *             calcula e a faixa de entradas em que nenhum passo estoura, e
+ *             é aplicado de uma vez; os demais segmentos ( e os que estouram
+ *             para a entrada dada ) são percorridos pelos filhos. Uma edição
+ *             custa O(log n) por cadeia no caminho até a raiz, mais O(log n)
+ *             por estouro intermediário; cadeias de "/", "%" e "^" continuam
+ *             lineares no seu tamanho.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _EXPRESSION_TREE_H_
+#define _EXPRESSION_TREE_H_
+
+#include <vector>   	// std::vector
+#include <cstddef>  	// std::size_t, std::ptrdiff_t
+
+#include "token.hpp"    	// Token
+#include "parser.hpp"   	// Parser::ParserResult
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+
+/**
+ * @brief      Árvore de expressão com valores em cache e edição incremental de
+ *             literais
+ */
+class ExpressionTree
+{
+	public:
+
+		using value_type = Evaluator::value_type;
+		using size_type = std::size_t;
+		using code_t = Evaluator::EvaluatorResult::code_t;
+
+		static constexpr size_type NIL = static_cast< size_type >( -1 );
+
+	private:
+
+		/**
+		 * @brief      Nó da árvore, folhas são literais ( op == 0 )
+		 */
+		struct Node
+		{
+			value_type value;   // Valor em cache ( mantido nos literais e no topo das cadeias )
+			code_t type;        // Código do último operador avaliado no nó
+			char op;            // Operador, ou 0 para literais
+			size_type left;     // Índice do filho esquerdo
+			size_type right;    // Índice do filho direito
+			size_type parent;   // Índice do pai, NIL para a raiz
+			std::ptrdiff_t col; // Coluna do token na expressão original
+			size_type chain;    // Cadeia do operador, NIL para literais
+			size_type pos;      // Posição do operador na cadeia
+		};
+
+		/**
+		 * @brief      Função calculada por um segmento de uma cadeia
+		 * @details    Se linear, para toda entrada v em [lo, hi] nenhum passo
+		 *             estoura e o resultado é y0 + a * ( v - v0 ), com v0 = lo.
+		 */
+		struct Piece
+		{
+			bool linear;     // Se o segmento é só de "+", "-" e "*" e a faixa não é vazia
+			value_type a;    // Inclinação ( 0 quando lo == hi )
+			value_type v0;   // Entrada de referência
+			value_type y0;   // Resultado para v0
+			value_type lo;   // Menor entrada sem estouro
+			value_type hi;   // Maior entrada sem estouro
+		};
+
+		/**
+		 * @brief      Descida pela esquerda: um literal e as operações que o
+		 *             seguem, de baixo para cima
+		 */
+		struct Chain
+		{
+			size_type first;                // Índice do literal do início
+			std::vector< size_type > ops;   // Índices dos operadores, em ordem de avaliação
+			std::vector< Piece > seg;       // Árvore de segmentos sobre ops ( 2 * ops.size() - 1 nós )
+		};
+
+		std::vector< Node > nodes;          // Nós, filhos sempre antes dos pais
+		std::vector< size_type > literals;  // Índice do nó de cada literal, na ordem do texto
+		std::vector< Chain > chains;        // Cadeias, na ordem dos seus topos
+		size_type root = NIL;               // Índice da raiz
+
+		/**
+		 * @brief      Recalcula o valor de um nó interno a partir dos filhos
+		 *
+		 * @param[in]  id    Índice do nó
+		 */
+		void recompute( size_type id );
+
+		/**
+		 * @brief      Função de uma única operação com o termo direito fixo
+		 *
+		 * @param[in]  op     Operador
+		 * @param[in]  right  Valor do termo direito
+		 *
+		 * @return     O segmento, não linear para "/", "%" e "^"
+		 */
+		static Piece piece( char op, value_type right );
+
+		/**
+		 * @brief      Função de um segmento seguido de outro
+		 *
+		 * @param[in]  f     Segmento aplicado primeiro
+		 * @param[in]  g     Segmento aplicado depois
+		 *
+		 * @return     O segmento g( f( v ) )
+		 */
+		static Piece compose( const Piece & f, const Piece & g );
+
+		/**
+		 * @brief      Monta ou atualiza a árvore de segmentos de uma cadeia
+		 *
+		 * @param      c     A cadeia
+		 * @param[in]  k     Nó da árvore de segmentos
+		 * @param[in]  l     Primeira operação do nó
+		 * @param[in]  r     Uma depois da última operação do nó
+		 * @param[in]  pos   Operação alterada, ou NIL para montar tudo
+		 */
+		void update( Chain & c, size_type k, size_type l, size_type r, size_type pos );
+
+		/**
+		 * @brief      Aplica as operações [l, r) de uma cadeia a um valor
+		 *
+		 * @param[in]  c     A cadeia
+		 * @param[in]  k     Nó da árvore de segmentos
+		 * @param[in]  l     Primeira operação do nó
+		 * @param[in]  r     Uma depois da última operação do nó
+		 * @param[in]  v     Valor antes da operação l
+		 * @param[out] type  Código da última operação aplicada
+		 *
+		 * @return     Valor depois da operação r - 1
+		 */
+		value_type run( const Chain & c, size_type k, size_type l, size_type r, value_type v, code_t & type ) const;
+
+	public:
+
+		/**
+		 * @brief      Construtor padrão da ExpressionTree ( árvore vazia )
+		 */
+		ExpressionTree() = default;
+
+		/**
+		 * @brief      Constrói a árvore a partir de uma expressão posfixa
+		 *
+		 * @param[in]  postfix  Expressão em notação posfixa
+		 */
+		explicit ExpressionTree( const std::vector< Token > & postfix );
+
+		/**
+		 * @brief      Descarta a árvore atual e constrói uma nova a partir da
+		 *             expressão posfixa informada, avaliando todos os nós
+		 *
+		 * @param[in]  postfix  Expressão em notação posfixa
+		 */
+		void build( const std::vector< Token > & postfix );
+
+		/**
+		 * @brief      Recupera o resultado da expressão, idêntico ao de
+		 *             Evaluator::evaluate_postfix
+		 *
+		 * @return     EvaluatorResult com o valor e o código da raiz
+		 */
+		Evaluator::EvaluatorResult result( void ) const;
+
+		/**
+		 * @brief      Informa a quantidade de literais da expressão
+		 *
+		 * @return     Número de literais
+		 */
+		size_type literal_count( void ) const;
+
+		/**
+		 * @brief      Procura o literal que começa na coluna informada
+		 *
+		 * @param[in]  col   Coluna ( 0-based ) na expressão original
+		 *
+		 * @return     Índice do literal, ou NIL se não houver literal na coluna
+		 */
+		size_type literal_at_col( std::ptrdiff_t col ) const;
+
+		/**
+		 * @brief      Troca o valor do literal de índice informado e recalcula
+		 *             apenas as cadeias no caminho até a raiz
+		 *
+		 * @param[in]  index  Índice do literal ( ordem em que aparece no texto )
+		 * @param[in]  value  Novo valor do literal
+		 *
+		 * @return     PARSER_OK, ou INTEGER_OUT_OF_RANGE com a coluna do literal
+		 *             se o valor não for aceito pelo Parser
+		 */
+		Parser::ParserResult replace_literal( size_type index, value_type value );
+
+		/**
+		 * @brief      Troca o valor do literal que começa na coluna informada
+		 *
+		 * @param[in]  col    Coluna ( 0-based ) na expressão original
+		 * @param[in]  value  Novo valor do literal
+		 *
+		 * @return     PARSER_OK, ILL_FORMED_INTEGER se não há literal na coluna
+		 *             ou INTEGER_OUT_OF_RANGE se o valor não for aceito
+		 */
+		Parser::ParserResult replace_literal_at_col( std::ptrdiff_t col, value_type value );
+};
+
+#endif
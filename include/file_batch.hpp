@@ -0,0 +1,138 @@
+/**
+ * @file file_batch.hpp
+ * @brief      Declaração dos métodos e atributos da classe FileBatch
+ * @details    Processa muitos arquivos de entrada em um único processo. A
+ *             thread que chama run() cuida apenas da E/S: as leituras e
+ *             escritas vão para um io_uring com até WINDOW arquivos em
+ *             andamento ao mesmo tempo. Cada arquivo lido por completo vira uma
+ *             tarefa do ThreadPool, que o avalia como "bares < entrada" e
+ *             avisa a thread de E/S por um eventfd ( também lido pelo anel ).
+ *             Sem io_uring ( kernel antigo ou seccomp ), cada arquivo é lido,
+ *             avaliado e gravado de forma síncrona por uma tarefa do pool.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _FILE_BATCH_H_
+#define _FILE_BATCH_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint32_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "thread_pool.hpp"	// ThreadPool
+#include "io_ring.hpp"    	// IoRing
+
+/**
+ * @brief      Avaliação de uma lista de arquivos com E/S assíncrona
+ */
+class FileBatch
+{
+	public:
+
+		using size_type = std::size_t;
+
+		/**
+		 * @brief      Quantidade máxima de arquivos em andamento
+		 */
+		static constexpr size_type WINDOW = 64;
+
+		/**
+		 * @brief      Tamanho da fila de submissão do io_uring
+		 * @details    Cada arquivo em andamento tem no máximo uma requisição
+		 *             pendente, além da leitura do eventfd, então a fila nunca
+		 *             enche; se encher mesmo assim, as entradas preparadas são
+		 *             enviadas ao kernel antes de tentar de novo
+		 */
+		static constexpr unsigned RING_ENTRIES = 2 * WINDOW;
+
+		static_assert( RING_ENTRIES >= WINDOW + 1, "o anel precisa de uma entrada por arquivo e uma para o eventfd" );
+
+		/**
+		 * @brief      Tamanho máximo de cada leitura ou escrita
+		 */
+		static constexpr std::uint32_t CHUNK = 1 << 20;
+
+		/**
+		 * @brief      Um arquivo de entrada e o arquivo onde gravar a saída
+		 */
+		struct Job
+		{
+			std::string input;
+			std::string output;
+		};
+
+	private:
+
+		/**
+		 * @brief      Situação de um arquivo durante o processamento
+		 */
+		struct State
+		{
+			int in = -1;              // Descritor da entrada
+			int out = -1;             // Descritor da saída
+			std::vector< char > data; // Conteúdo lido, depois a saída formatada
+			size_type done = 0;       // Bytes já lidos ou já gravados
+			bool grow = false;        // Entrada sem tamanho ( pipe, /proc ): lê até o fim
+			std::string error;        // Mensagem de erro, vazia se deu certo
+			bool finished = false;    // Se já terminou ( com ou sem erro )
+		};
+
+		ThreadPool pool;                // Avalia os arquivos
+		IoRing ring;                    // E/S assíncrona
+		std::uint64_t event_value = 0;  // Destino das leituras do eventfd pelo anel
+
+		/**
+		 * @brief      Processa os arquivos pelo io_uring
+		 */
+		void run_ring( const std::vector< Job > & jobs, std::vector< State > & states );
+
+		/**
+		 * @brief      Processa os arquivos com E/S síncrona, um por tarefa
+		 */
+		void run_sync( const std::vector< Job > & jobs, std::vector< State > & states );
+
+	public:
+
+		/**
+		 * @brief      Construtor do FileBatch
+		 *
+		 * @param[in]  threads  Threads de avaliação ( 0 para uma por núcleo ),
+		 *                      além da thread de E/S
+		 */
+		explicit FileBatch( size_type threads = 0 );
+
+		/**
+		 * @brief      Avalia cada entrada e grava o resultado na saída
+		 *             correspondente, mantendo a ordem das linhas
+		 *
+		 * @param[in]  jobs  Os pares de arquivos
+		 *
+		 * @return     Quantidade de arquivos que falharam ( as mensagens vão
+		 *             para a saída de erro )
+		 */
+		size_type run( const std::vector< Job > & jobs );
+
+		/**
+		 * @brief      Informa se as E/S passam pelo io_uring
+		 *
+		 * @return     True se o io_uring está disponível
+		 */
+		bool uses_io_uring( void ) const;
+
+		/**
+		 * @brief      Avalia o conteúdo de um arquivo como "bares < arquivo"
+		 *             ( uma expressão por linha, até o fim ou até "q"/"p" )
+		 *
+		 * @param[in]  text  Conteúdo do arquivo
+		 * @param[in]  n     Tamanho do conteúdo
+		 *
+		 * @return     A saída que o bares produziria
+		 */
+		static std::vector< char > evaluate( const char * text, size_type n );
+};
+
+#endif
@@ -0,0 +1,123 @@
+/**
+ * @file file_follower.hpp
+ * @brief      Declaração dos métodos e atributos da classe FileFollower
+ * @details    Acompanha um arquivo que cresce ( "bares --follow" ), como o
+ *             "tail -F": a thread dorme em um descritor do inotify e acorda
+ *             assim que o arquivo é modificado, lendo apenas os bytes novos a
+ *             partir da posição em que parou. Só as linhas completas são
+ *             entregues; o que vem depois do último '\n' espera o resto.
+ *
+ *             O diretório também é observado, então a rotação ( o arquivo é
+ *             renomeado e outro é criado com o mesmo nome ) é percebida: o
+ *             arquivo antigo é lido até o fim e o novo passa a ser lido do
+ *             início. Se o arquivo diminui ( truncado no lugar ), a leitura
+ *             volta para o início.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _FILE_FOLLOWER_H_
+#define _FILE_FOLLOWER_H_
+
+#include <cstdint>  	// std::uint64_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include <sys/types.h>	// dev_t, ino_t
+
+/**
+ * @brief      Leitor das linhas acrescentadas a um arquivo
+ */
+class FileFollower
+{
+	private:
+
+		std::string path;         // Arquivo acompanhado
+		int notify = -1;          // Descritor do inotify
+		int fd = -1;              // Arquivo aberto no momento
+		int file_watch = -1;      // Observação do arquivo aberto
+		int dir_watch = -1;       // Observação do diretório
+		dev_t device = 0;         // Identidade do arquivo aberto
+		ino_t inode = 0;
+		std::uint64_t offset = 0; // Bytes já lidos do arquivo aberto
+		std::string partial;      // Linha ainda sem '\n'
+
+		/**
+		 * @brief      Abre o arquivo do caminho e passa a observá-lo
+		 *
+		 * @return     Vazio se abriu, ou a descrição do erro
+		 */
+		std::string open_file( void );
+
+		/**
+		 * @brief      Lê tudo o que existe depois da posição atual
+		 *
+		 * @param      lines  Onde acrescentar as linhas completas
+		 *
+		 * @return     Vazio se leu, ou a descrição do erro
+		 */
+		std::string drain( std::vector< std::string > & lines );
+
+		/**
+		 * @brief      Troca de arquivo se outro tomou o lugar do caminho
+		 *
+		 * @param      lines  Onde acrescentar a última linha do arquivo
+		 *                    antigo, se ela não terminou com '\n'
+		 *
+		 * @return     True se trocou
+		 */
+		bool rotated( std::vector< std::string > & lines );
+
+	public:
+
+		/**
+		 * @brief      Construtor do FileFollower
+		 *
+		 * @param[in]  path_  Caminho do arquivo
+		 */
+		explicit FileFollower( const std::string & path_ );
+
+		/**
+		 * @brief      Destrutor, fecha os descritores
+		 */
+		~FileFollower();
+
+		/**
+		 * @brief      Construtor cópia do FileFollower deletado
+		 *
+		 * @param[in]  other  O outro FileFollower
+		 */
+		FileFollower( const FileFollower & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro FileFollower
+		 *
+		 * @return     O novo FileFollower
+		 */
+		FileFollower & operator=( const FileFollower & other ) = delete;
+
+		/**
+		 * @brief      Abre o arquivo e o inotify
+		 *
+		 * @param[in]  from_start  Ler o conteúdo atual ( senão, só o que for
+		 *                         acrescentado )
+		 *
+		 * @return     Vazio se abriu, ou a descrição do erro
+		 */
+		std::string start( bool from_start );
+
+		/**
+		 * @brief      Espera até haver ao menos uma linha nova completa
+		 *
+		 * @param[out] lines  As linhas novas
+		 *
+		 * @return     Vazio se leu, ou a descrição do erro
+		 */
+		std::string wait( std::vector< std::string > & lines );
+};
+
+#endif
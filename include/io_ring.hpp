@@ -0,0 +1,163 @@
+/**
+ * @file io_ring.hpp
+ * @brief      Declaração dos métodos e atributos da classe IoRing
+ * @details    Invólucro mínimo de um io_uring do Linux, feito direto sobre as
+ *             chamadas de sistema io_uring_setup e io_uring_enter ( sem
+ *             liburing ). Oferece apenas o que o processamento de arquivos em
+ *             lote precisa: leituras e escritas com deslocamento, identificadas
+ *             por uma etiqueta de 64 bits, e a coleta das conclusões. Quando o
+ *             kernel ( ou o seccomp de um contêiner ) não oferece io_uring,
+ *             is_available() informa False e quem usa deve ler e escrever de
+ *             forma síncrona.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _IO_RING_H_
+#define _IO_RING_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint64_t, std::uint32_t
+
+/**
+ * @brief      Fila de submissão e de conclusão de E/S assíncrona
+ */
+class IoRing
+{
+	public:
+
+		using size_type = std::size_t;
+
+	private:
+
+		int fd = -1;                       // Descritor do io_uring
+
+		void * sq_ring = nullptr;          // Anel de submissão mapeado
+		void * cq_ring = nullptr;          // Anel de conclusão mapeado
+		void * sqes = nullptr;             // Vetor de entradas de submissão
+		size_type sq_ring_size = 0;
+		size_type cq_ring_size = 0;
+		size_type sqes_size = 0;
+
+		std::uint32_t * sq_head = nullptr;
+		std::uint32_t * sq_tail = nullptr;
+		std::uint32_t * sq_mask = nullptr;
+		std::uint32_t * sq_array = nullptr;
+		std::uint32_t sq_entries = 0;
+
+		std::uint32_t * cq_head = nullptr;
+		std::uint32_t * cq_tail = nullptr;
+		std::uint32_t * cq_mask = nullptr;
+		void * cqes = nullptr;
+
+		std::uint32_t to_submit = 0;       // Entradas preparadas e ainda não enviadas
+		size_type in_flight = 0;           // Enviadas e ainda não concluídas
+
+		/**
+		 * @brief      Prepara uma entrada de leitura ou escrita
+		 *
+		 * @return     False se a fila de submissão está cheia
+		 */
+		bool prepare( unsigned char opcode, int file, const void * buf, std::uint32_t len,
+			std::uint64_t offset, std::uint64_t tag );
+
+		/**
+		 * @brief      Libera os mapeamentos e o descritor
+		 */
+		void close( void );
+
+	public:
+
+		/**
+		 * @brief      Cria um io_uring com o número de entradas informado
+		 *
+		 * @param[in]  entries  Tamanho da fila de submissão
+		 */
+		explicit IoRing( unsigned entries );
+
+		/**
+		 * @brief      Destrutor do IoRing
+		 */
+		~IoRing();
+
+		/**
+		 * @brief      Construtor cópia do IoRing deletado
+		 *
+		 * @param[in]  other  O outro IoRing
+		 */
+		IoRing( const IoRing & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro IoRing
+		 *
+		 * @return     O novo IoRing
+		 */
+		IoRing & operator=( const IoRing & other ) = delete;
+
+		/**
+		 * @brief      Informa se o io_uring foi criado
+		 *
+		 * @return     True se pode ser usado, False caso contrário
+		 */
+		bool is_available( void ) const;
+
+		/**
+		 * @brief      Enfileira uma leitura de len bytes a partir de offset
+		 *
+		 * @param[in]  file    Descritor do arquivo
+		 * @param      buf     Destino
+		 * @param[in]  len     Quantidade de bytes
+		 * @param[in]  offset  Posição no arquivo
+		 * @param[in]  tag     Etiqueta devolvida na conclusão
+		 *
+		 * @return     False se a fila de submissão está cheia
+		 */
+		bool read( int file, void * buf, std::uint32_t len, std::uint64_t offset, std::uint64_t tag );
+
+		/**
+		 * @brief      Enfileira uma escrita de len bytes a partir de offset
+		 *
+		 * @param[in]  file    Descritor do arquivo
+		 * @param[in]  buf     Origem
+		 * @param[in]  len     Quantidade de bytes
+		 * @param[in]  offset  Posição no arquivo
+		 * @param[in]  tag     Etiqueta devolvida na conclusão
+		 *
+		 * @return     False se a fila de submissão está cheia
+		 */
+		bool write( int file, const void * buf, std::uint32_t len, std::uint64_t offset, std::uint64_t tag );
+
+		/**
+		 * @brief      Envia as entradas preparadas e espera ao menos wait_nr
+		 *             conclusões
+		 *
+		 * @param[in]  wait_nr  Quantidade mínima de conclusões ( 0 não bloqueia )
+		 *
+		 * @return     0, ou -errno se io_uring_enter falhou
+		 */
+		int submit( unsigned wait_nr = 0 );
+
+		/**
+		 * @brief      Retira a próxima conclusão, se houver
+		 *
+		 * @param[out] tag   Etiqueta da requisição
+		 * @param[out] res   Resultado ( bytes transferidos ou -errno )
+		 *
+		 * @return     False se não há conclusões disponíveis
+		 */
+		bool pop( std::uint64_t & tag, int & res );
+
+		/**
+		 * @brief      Informa quantas requisições foram enviadas e ainda não
+		 *             concluíram
+		 *
+		 * @return     Requisições em andamento
+		 */
+		size_type pending( void ) const;
+};
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file jit.hpp
+ * @brief      Declaração dos métodos e atributos da classe JitExpression
+ * @details    Traduz uma Program ( a posfixa de Evaluator::infix_to_postfix )
+ *             para código nativo x86-64 em páginas executáveis obtidas com
+ *             mmap. Os testes de divisão por zero e de estouro são feitos no
+ *             próprio código gerado e devolvem os mesmos códigos de
+ *             EvaluatorResult. Em outras arquiteturas, ou quando compilado com
+ *             BARES_NO_JIT, a Program é executada pelo interpretador.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _JIT_H_
+#define _JIT_H_
+
+#include <cstddef>  	// std::size_t
+
+#include "program.hpp"  	// Program
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+
+#if defined(__x86_64__) && defined(__linux__) && not defined(BARES_NO_JIT)
+#define BARES_JIT_NATIVE 1
+#endif
+
+/**
+ * @brief      Expressão compilada para código nativo, com o interpretador de
+ *             Program como alternativa
+ */
+class JitExpression
+{
+	public:
+
+		using value_type = Evaluator::value_type;
+
+		/**
+		 * @brief      Assinatura do código gerado: recebe os slots e onde
+		 *             guardar o valor, devolve o código do resultado
+		 */
+		typedef int ( *entry_t )( const value_type * operands, value_type * out );
+
+	private:
+
+		Program program;           // Programa original, usado como alternativa
+		void * code = nullptr;     // Páginas executáveis com o código gerado
+		std::size_t code_size = 0; // Tamanho do mapeamento
+		entry_t entry = nullptr;   // Ponto de entrada do código gerado
+
+		/**
+		 * @brief      Gera o código nativo para o programa atual
+		 *
+		 * @return     True se o código foi gerado, False caso contrário
+		 */
+		bool emit( void );
+
+	public:
+
+		/**
+		 * @brief      Compila o programa informado
+		 *
+		 * @param[in]  prog  O programa a ser compilado
+		 */
+		explicit JitExpression( const Program & prog );
+
+		/**
+		 * @brief      Destrutor, libera as páginas executáveis
+		 */
+		~JitExpression();
+
+		/**
+		 * @brief      Construtor cópia da JitExpression deletado
+		 *
+		 * @param[in]  other  A outra JitExpression
+		 */
+		JitExpression( const JitExpression & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  A outra JitExpression
+		 *
+		 * @return     A nova JitExpression
+		 */
+		JitExpression & operator=( const JitExpression & other ) = delete;
+
+		/**
+		 * @brief      Informa se a expressão está sendo executada como código
+		 *             nativo
+		 *
+		 * @return     True se há código nativo, False se o interpretador é usado
+		 */
+		bool is_native( void ) const;
+
+		/**
+		 * @brief      Executa a expressão com os literais originais
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix
+		 */
+		Evaluator::EvaluatorResult run( void ) const;
+
+		/**
+		 * @brief      Executa a expressão com outros valores nos slots
+		 *
+		 * @param[in]  operands  Um valor por slot, cada um dentro da faixa de
+		 *                       Parser::required_int_type
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix
+		 */
+		Evaluator::EvaluatorResult run( const value_type * operands ) const;
+};
+
+#endif
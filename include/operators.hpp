@@ -0,0 +1,174 @@
+/**
+ * @file operators.hpp
+ * @brief      Tabela dos operadores do BARES
+ * @details    Cada operador é descrito uma única vez, em uma tabela constexpr:
+ *             símbolo, precedência, associatividade, se o divisor precisa ser
+ *             testado e a função que calcula o resultado. O Parser ( análise
+ *             léxica e sintática ), o Evaluator ( shunting-yard e avaliação ) e
+ *             a avaliação em tempo de compilação ( constexpr_bares.hpp )
+ *             consultam a tabela por um índice obtido com um único acesso a
+ *             partir do caractere, em vez de cadeias de comparações. Os
+ *             códigos de operação de Program são a posição na tabela, então o
+ *             JIT, a RangeAnalysis e os lotes por formato também a seguem. Um
+ *             novo operador é uma nova linha da tabela, sem custo extra por
+ *             token.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _OPERATORS_H_
+#define _OPERATORS_H_
+
+#include <cmath>    	// std::pow
+#include <cstddef>  	// std::size_t
+
+namespace bares
+{
+	using operand_type = long int;	// O mesmo Evaluator::value_type
+	using kernel_type = operand_type ( * )( operand_type, operand_type );
+
+	/**
+	 * @brief      Funções que calculam cada operação, sem testes de erro ( o
+	 *             divisor zero e o intervalo são tratados por quem chama )
+	 */
+	namespace kernel
+	{
+		inline operand_type add( operand_type a, operand_type b ) { return a + b; }
+		inline operand_type sub( operand_type a, operand_type b ) { return a - b; }
+		inline operand_type mul( operand_type a, operand_type b ) { return a * b; }
+		inline operand_type div( operand_type a, operand_type b ) { return a / b; }
+		inline operand_type mod( operand_type a, operand_type b ) { return a % b; }
+		inline operand_type pow( operand_type a, operand_type b ) { return static_cast< operand_type >( std::pow( a, b ) ); }
+	}
+
+	/**
+	 * @brief      Descrição de um operador
+	 */
+	struct Operator
+	{
+		char symbol;             // Símbolo na expressão
+		short precedence;        // Prioridade ( maior sai antes )
+		bool right_associative;  // Associativo à direita ( "^" )
+		bool checks_divisor;     // Divisão por zero é um erro
+		kernel_type kernel;      // A operação
+	};
+
+	/**
+	 * @brief      A tabela dos operadores
+	 */
+	constexpr Operator OPERATORS[] =
+	{
+		{ '+', 1, false, false, &kernel::add },
+		{ '-', 1, false, false, &kernel::sub },
+		{ '*', 2, false, false, &kernel::mul },
+		{ '/', 2, false, true,  &kernel::div },
+		{ '%', 2, false, true,  &kernel::mod },
+		{ '^', 3, true,  false, &kernel::pow }
+	};
+
+	constexpr std::size_t OPERATOR_COUNT = sizeof( OPERATORS ) / sizeof( OPERATORS[0] );
+
+	/**
+	 * @brief      Índice usado para caracteres que não são operadores
+	 */
+	constexpr unsigned char NOT_AN_OPERATOR = 0xff;
+
+	/**
+	 * @brief      Índice na tabela para cada um dos 256 caracteres
+	 */
+	struct OperatorIndex
+	{
+		unsigned char slot[256];
+	};
+
+	/**
+	 * @brief      Monta o índice a partir da tabela
+	 *
+	 * @return     O índice
+	 */
+	constexpr OperatorIndex make_operator_index( void )
+	{
+		OperatorIndex index{};
+
+		for ( std::size_t c = 0; c < 256; ++c )
+		{
+			index.slot[ c ] = NOT_AN_OPERATOR;
+		}
+		for ( std::size_t i = 0; i < OPERATOR_COUNT; ++i )
+		{
+			index.slot[ static_cast< unsigned char >( OPERATORS[ i ].symbol ) ] = static_cast< unsigned char >( i );
+		}
+
+		return index;
+	}
+
+	constexpr OperatorIndex OPERATOR_INDEX = make_operator_index();
+
+	/**
+	 * @brief      Posição do operador na tabela
+	 *
+	 * @param[in]  c     Símbolo do operador
+	 *
+	 * @return     O índice, ou NOT_AN_OPERATOR
+	 */
+	constexpr unsigned char operator_index( char c )
+	{
+		return OPERATOR_INDEX.slot[ static_cast< unsigned char >( c ) ];
+	}
+
+	/**
+	 * @brief      Determina se o caractere é um operador
+	 *
+	 * @param[in]  c     O caractere
+	 *
+	 * @return     True se estiver na tabela
+	 */
+	constexpr bool is_operator( char c )
+	{
+		return operator_index( c ) != NOT_AN_OPERATOR;
+	}
+
+	/**
+	 * @brief      Determina qual a prioridade de um operador
+	 *
+	 * @param[in]  c     Símbolo do operador
+	 *
+	 * @return     A prioridade do operador, 0 se não for um operador
+	 */
+	constexpr short precedence( char c )
+	{
+		return is_operator( c ) ? OPERATORS[ operator_index( c ) ].precedence : 0;
+	}
+
+	/**
+	 * @brief      Determina se o operador é associativo à direita ( "^" )
+	 *
+	 * @param[in]  c     Símbolo do operador
+	 *
+	 * @return     True se for associativo à direita, False caso contrário
+	 */
+	constexpr bool is_right_associative( char c )
+	{
+		return is_operator( c ) and OPERATORS[ operator_index( c ) ].right_associative;
+	}
+
+	/**
+	 * @brief      Determina se o operador do topo da pilha deve sair antes de
+	 *             empilhar o novo operador ( regra do shunting-yard )
+	 *
+	 * @param[in]  top   Operador no topo da pilha
+	 * @param[in]  next  Operador que será empilhado
+	 *
+	 * @return     True se o topo tiver maior prioridade, False caso contrário
+	 */
+	constexpr bool has_higher_precedence( char top, char next )
+	{
+		return ( precedence( top ) == precedence( next ) and is_right_associative( top ) )
+			? false
+			: precedence( top ) >= precedence( next );
+	}
+}
+
+#endif
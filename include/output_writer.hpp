@@ -0,0 +1,160 @@
+/**
+ * @file output_writer.hpp
+ * @brief      Declaração dos métodos e atributos da classe OutputWriter
+ * @details    Camada de saída do bares. Os resultados são formatados direto em
+ *             um buffer grande e reutilizado: inteiros com uma rotina no
+ *             estilo de to_chars ( dois dígitos por vez ) e mensagens de erro a
+ *             partir de modelos pré-montados, onde apenas a coluna é inserida.
+ *             O buffer é descarregado com poucas chamadas grandes a write(2).
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _OUTPUT_WRITER_H_
+#define _OUTPUT_WRITER_H_
+
+#include <cstddef>  	// std::size_t
+#include <vector>   	// std::vector
+
+#include "parser.hpp"   	// Parser::ParserResult
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+
+/**
+ * @brief      Escritor bufferizado dos resultados do bares
+ */
+class OutputWriter
+{
+	public:
+
+		using size_type = std::size_t;
+
+		static constexpr size_type DEFAULT_CAPACITY = 1 << 16;
+
+		/**
+		 * @brief      Maior quantidade de caracteres de um inteiro formatado
+		 */
+		static constexpr size_type MAX_INTEGER_CHARS = 20;
+
+		/**
+		 * @brief      Descritor especial: a saída fica em memória ( o buffer
+		 *             cresce e é recuperado com release() )
+		 */
+		static constexpr int MEMORY = -1;
+
+	private:
+
+		int fd;                     // Descritor onde a saída é escrita
+		std::vector< char > buffer; // Buffer reutilizado
+		size_type used = 0;         // Bytes ocupados no buffer
+		bool failed = false;        // Se alguma escrita falhou
+
+		/**
+		 * @brief      Garante espaço contíguo para n bytes, descarregando o
+		 *             buffer se necessário
+		 *
+		 * @param[in]  n     Bytes necessários ( no máximo a capacidade )
+		 *
+		 * @return     Ponteiro para o espaço livre
+		 */
+		char * reserve( size_type n );
+
+		/**
+		 * @brief      Escreve um modelo com a coluna ( 1-based ) inserida
+		 *
+		 * @param[in]  prefix  Texto antes da coluna
+		 * @param[in]  n       Tamanho do prefixo
+		 * @param[in]  col     A coluna ( 0-based ) do erro
+		 */
+		void write_with_column( const char * prefix, size_type n, long long col );
+
+	public:
+
+		/**
+		 * @brief      Construtor do OutputWriter
+		 *
+		 * @param[in]  fd_        Descritor da saída ( padrão: saída padrão ) ou
+		 *                        MEMORY
+		 * @param[in]  capacity_  Tamanho do buffer
+		 */
+		explicit OutputWriter( int fd_ = 1, size_type capacity_ = DEFAULT_CAPACITY );
+
+		/**
+		 * @brief      Destrutor, descarrega o que restou no buffer
+		 */
+		~OutputWriter();
+
+		/**
+		 * @brief      Construtor cópia do OutputWriter deletado
+		 *
+		 * @param[in]  other  O outro OutputWriter
+		 */
+		OutputWriter( const OutputWriter & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro OutputWriter
+		 *
+		 * @return     O novo OutputWriter
+		 */
+		OutputWriter & operator=( const OutputWriter & other ) = delete;
+
+		/**
+		 * @brief      Escreve o valor de uma expressão seguido de '\n'
+		 *
+		 * @param[in]  value  O valor
+		 */
+		void write_value( long long value );
+
+		/**
+		 * @brief      Escreve a mensagem de erro do Parser, como o antigo
+		 *             print_parser_error
+		 *
+		 * @param[in]  result  O resultado da avaliação do Parser
+		 */
+		void write_parser_error( const Parser::ParserResult & result );
+
+		/**
+		 * @brief      Escreve a mensagem de erro do Evaluator, como o antigo
+		 *             print_evaluator_error
+		 *
+		 * @param[in]  result  O resultado da avaliação do Evaluator
+		 */
+		void write_evaluator_error( const Evaluator::EvaluatorResult & result );
+
+		/**
+		 * @brief      Escreve bytes sem formatação
+		 *
+		 * @param[in]  data  Os bytes
+		 * @param[in]  n     Quantidade de bytes
+		 */
+		void write( const char * data, size_type n );
+
+		/**
+		 * @brief      Descarrega o buffer com write(2)
+		 *
+		 * @return     True se todas as escritas até agora deram certo
+		 */
+		bool flush( void );
+
+		/**
+		 * @brief      Entrega o que foi escrito em memória e recomeça vazio
+		 *
+		 * @return     Os bytes escritos desde o último release()
+		 */
+		std::vector< char > release( void );
+
+		/**
+		 * @brief      Formata um inteiro em base 10 ( como std::to_chars )
+		 *
+		 * @param      out    Destino, com espaço para MAX_INTEGER_CHARS
+		 * @param[in]  value  O valor
+		 *
+		 * @return     Ponteiro para depois do último caractere escrito
+		 */
+		static char * format_integer( char * out, long long value );
+};
+
+#endif
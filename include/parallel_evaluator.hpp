@@ -0,0 +1,67 @@
+/**
+ * @file parallel_evaluator.hpp
+ * @brief      Declaração dos métodos e atributos da classe ParallelEvaluator
+ * @details    Avalia uma única expressão muito grande usando várias threads.
+ *             Na posfixa cada subárvore ocupa um trecho contíguo, então a
+ *             árvore é montada apenas com o tamanho de cada subárvore. As
+ *             maiores subárvores com até `threshold` nós viram tarefas
+ *             independentes no ThreadPool e os nós acima delas são combinados
+ *             em série, na ordem da posfixa. O resultado ( inclusive os códigos
+ *             DIVISION_BY_ZERO e NUMERIC_OVERFLOW ) é idêntico ao de
+ *             Evaluator::evaluate_postfix e não depende da ordem das threads.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _PARALLEL_EVALUATOR_H_
+#define _PARALLEL_EVALUATOR_H_
+
+#include <cstddef>  	// std::size_t
+#include <vector>   	// std::vector
+
+#include "token.hpp"      	// Token
+#include "evaluator.hpp"  	// Evaluator::EvaluatorResult
+#include "thread_pool.hpp"	// ThreadPool
+
+/**
+ * @brief      Avaliador de expressões posfixas que divide a árvore entre
+ *             threads
+ */
+class ParallelEvaluator
+{
+	public:
+
+		using value_type = Evaluator::value_type;
+		using size_type = std::size_t;
+
+		static constexpr size_type DEFAULT_THRESHOLD = 1 << 14;
+
+	private:
+
+		ThreadPool & pool;   // Pool onde as tarefas são executadas
+		size_type threshold; // Tamanho máximo de uma subárvore avaliada em série
+
+	public:
+
+		/**
+		 * @brief      Construtor do ParallelEvaluator
+		 *
+		 * @param      pool_       Pool onde as tarefas são executadas
+		 * @param[in]  threshold_  Tamanho máximo de uma subárvore avaliada por
+		 *                         uma única tarefa
+		 */
+		explicit ParallelEvaluator( ThreadPool & pool_, size_type threshold_ = DEFAULT_THRESHOLD );
+
+		/**
+		 * @brief      Avalia o valor representado pela expressão posfixa
+		 *
+		 * @param[in]  postfix  Expressão a ser avaliada
+		 *
+		 * @return     O mesmo EvaluatorResult de Evaluator::evaluate_postfix
+		 */
+		Evaluator::EvaluatorResult evaluate_postfix( const std::vector< Token > & postfix ) const;
+};
+
+#endif
@@ -0,0 +1,157 @@
+/**
+ * @file parallel_parser.hpp
+ * @brief      Declaração dos métodos e atributos da classe ParallelParser
+ * @details    Tokenização paralela de expressões muito longas. O texto é
+ *             dividido em blocos que nunca cortam uma sequência de dígitos;
+ *             cada bloco é separado em lexemas na sua própria thread, junto com
+ *             o saldo e o mínimo da profundidade de parênteses. Os blocos são
+ *             costurados com uma soma de prefixos ( posição de cada bloco no
+ *             vetor final e profundidade inicial de cada um ) e, por fim, uma
+ *             verificação da gramática sobre os lexemas produz os mesmos
+ *             tokens, códigos de ParserResult e colunas ( at_col ) do Parser.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _PARALLEL_PARSER_H_
+#define _PARALLEL_PARSER_H_
+
+#include <cstddef>  	// std::size_t, std::ptrdiff_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "token.hpp"      	// Token
+#include "parser.hpp"     	// Parser::ParserResult
+#include "thread_pool.hpp"	// ThreadPool
+
+/**
+ * @brief      Analisador com a mesma interface do Parser que separa os lexemas
+ *             em paralelo
+ */
+class ParallelParser
+{
+	public:
+
+		using size_type = std::size_t;
+		using ParserResult = Parser::ParserResult;
+
+		static constexpr size_type DEFAULT_CHUNK = 1 << 20;
+
+		/**
+		 * @brief      Um lexema: um símbolo ou uma sequência de dígitos
+		 */
+		struct Lexeme
+		{
+			char kind;          // '0', 'n' ( natural [1-9][0-9]* ), operador, '(' , ')' ou '?'
+			std::ptrdiff_t col; // Coluna do primeiro caractere
+			std::ptrdiff_t len; // Quantidade de caracteres
+		};
+
+	private:
+
+		/**
+		 * @brief      Resultado da separação de um bloco
+		 */
+		struct Chunk
+		{
+			std::vector< Lexeme > lexemes;
+			long net = 0;       // Abertos menos fechados
+			long min_depth = 0; // Menor profundidade relativa ao início do bloco
+			long max_depth = 0; // Maior profundidade relativa ao início do bloco
+		};
+
+		ThreadPool & pool;              // Pool onde os blocos são separados
+		size_type chunk_size;           // Tamanho aproximado de cada bloco
+
+		std::string expr;               // Expressão sendo analisada
+		std::vector< Lexeme > lexemes;  // Lexemas costurados
+		std::vector< Token > token_list;// Tokens extraídos da expressão
+		long max_depth = 0;             // Maior profundidade de parênteses
+		bool balanced = true;           // Se os parênteses estão balanceados
+
+		std::size_t k = 0;              // Próximo lexema
+		std::ptrdiff_t pos = 0;         // Posição atual, como o it_curr_symb do Parser
+
+		/**
+		 * @brief      Separa os lexemas de [first, last)
+		 */
+		void lex( Chunk & out, size_type first, size_type last ) const;
+
+		/**
+		 * @brief      Equivalente a Parser::skip_ws
+		 */
+		void skip_ws( void );
+
+		/**
+		 * @brief      Equivalente a Parser::accept, para um lexema
+		 */
+		bool accept( char kind );
+
+		/**
+		 * @brief      Equivalente a Parser::expect, para um lexema
+		 */
+		bool expect( char kind );
+
+		/**
+		 * @brief      Equivalente a Parser::end_input
+		 */
+		bool end_input( void ) const;
+
+		/**
+		 * @brief      Equivalente a Parser::integer
+		 */
+		ParserResult integer( void );
+
+		/**
+		 * @brief      Verificação da gramática de Parser::expression e
+		 *             Parser::term, sem recursão ( a pilha guarda, para cada
+		 *             parêntese aberto, se a expressão já leu um operador )
+		 */
+		ParserResult expression( void );
+
+	public:
+
+		/**
+		 * @brief      Construtor do ParallelParser
+		 *
+		 * @param      pool_   Pool onde os blocos são separados
+		 * @param[in]  chunk_  Tamanho aproximado de cada bloco
+		 */
+		explicit ParallelParser( ThreadPool & pool_, size_type chunk_ = DEFAULT_CHUNK );
+
+		/**
+		 * @brief      Tokeniza uma string, como Parser::parse
+		 *
+		 * @param[in]  e_    String a ser tokenizada
+		 *
+		 * @return     O mesmo resultado de Parser::parse
+		 */
+		ParserResult parse( std::string e_ );
+
+		/**
+		 * @brief      Recupera o vector com os tokens da string
+		 *
+		 * @return     Vector com os tokens
+		 */
+		std::vector< Token > get_tokens( void ) const;
+
+		/**
+		 * @brief      Informa a maior profundidade de parênteses encontrada
+		 *             pela soma de prefixos da última expressão
+		 *
+		 * @return     A maior profundidade
+		 */
+		long depth( void ) const;
+
+		/**
+		 * @brief      Informa se os parênteses da última expressão estão
+		 *             balanceados ( nunca fecham antes de abrir e terminam em 0 )
+		 *
+		 * @return     True se balanceados, False caso contrário
+		 */
+		bool is_balanced( void ) const;
+};
+
+#endif
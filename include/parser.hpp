@@ -132,12 +132,8 @@ class Parser
 		 */
 		enum class terminal_symbol_t
 		{
-			TS_PLUS,	        //<! "+"
-			TS_MINUS,	        //<! "-"
-			TS_MOD,             //<! "%"
-			TS_SLASH,           //<! "/"
-			TS_ASTERISK,        //<! "*"
-			TS_EXP,          	//<! "^"
+			TS_OPERATOR,        //<! Operadores binários de bares::OPERATORS, exceto "-"
+			TS_MINUS,	        //<! "-" ( binário ou sinal )
 			TS_CLOSING_SCOPE,   //<! ")"
 			TS_OPENING_SCOPE,   //<! "("
 			TS_ZERO,            //<! "0"
@@ -148,6 +144,24 @@ class Parser
 			TS_INVALID	        //<! invalid token
 		};
 
+		/**
+		 * @brief      Categoria de cada um dos 256 caracteres
+		 */
+		struct SymbolTable
+		{
+			terminal_symbol_t symbol[256];
+		};
+
+		/**
+		 * @brief      Monta a tabela de categorias ( os operadores vêm de
+		 *             bares::OPERATORS )
+		 *
+		 * @return     A tabela
+		 */
+		static constexpr SymbolTable make_symbol_table( void );
+
+		static const SymbolTable SYMBOLS;		// Usada pelo lexer
+
 		std::string expr;               		// Expressão a ser avaliada
 		std::string::iterator it_curr_symb;		// Ponteiro para o char atual dentro da expressão
 		std::vector< Token > token_list; 		// Lista com os tokens extraidos da expressão
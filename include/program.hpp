@@ -0,0 +1,220 @@
+/**
+ * @file program.hpp
+ * @brief      Declaração dos métodos e atributos da classe Program
+ * @details    Compila a expressão posfixa produzida por
+ *             Evaluator::infix_to_postfix em uma sequência compacta de
+ *             instruções, onde cada literal ocupa um slot. A mesma Program pode
+ *             ser executada várias vezes com valores diferentes nos slots, sem
+ *             precisar passar pelo Parser nem converter strings em números.
+ *             Operações provadas seguras pela RangeAnalysis são marcadas com
+ *             Instruction::UNCHECKED e executadas sem os testes de estouro e
+ *             de divisão por zero.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _PROGRAM_H_
+#define _PROGRAM_H_
+
+#include <vector>   	// std::vector
+#include <cstdint>  	// std::uint32_t
+#include <cstddef>  	// std::size_t
+
+#include "token.hpp"    	// Token
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+#include "operators.hpp"	// bares::OPERATORS, bares::operator_index
+
+/**
+ * @brief      Expressão posfixa compilada em instruções de uma máquina de pilha
+ */
+class Program
+{
+	public:
+
+		using value_type = Evaluator::value_type;
+		using size_type = std::size_t;
+
+		/**
+		 * @brief      Uma instrução da máquina de pilha
+		 */
+		struct Instruction
+		{
+			/**
+			 * @brief      Enum com os códigos de operação
+			 * @details    O código de um operador é a sua posição em
+			 *             bares::OPERATORS mais 1, então a tabela é a única
+			 *             fonte dos operadores de todos os backends.
+			 */
+			enum opcode_t : unsigned char
+			{
+				PUSH = 0,	// Empilha o valor do slot indicado
+				ADD = 1 + bares::operator_index( '+' ),
+				SUB = 1 + bares::operator_index( '-' ),
+				MUL = 1 + bares::operator_index( '*' ),
+				DIV = 1 + bares::operator_index( '/' ),
+				MOD = 1 + bares::operator_index( '%' ),
+				POW = 1 + bares::operator_index( '^' ),
+
+				OPCODE_COUNT = 1 + bares::OPERATOR_COUNT,	// PUSH mais um código por operador
+
+				UNCHECKED = 0x80	// Bit das operações que dispensam verificação
+			};
+
+			opcode_t op;        // A operação
+			std::uint32_t slot; // O slot do literal, usado apenas por PUSH
+		};
+
+		static_assert( Instruction::OPCODE_COUNT <= Instruction::UNCHECKED, "os códigos dos operadores não podem usar o bit UNCHECKED" );
+
+		// Os códigos são gravados nos catálogos ( catalog.hpp ): reordenar
+		// bares::OPERATORS mudaria o significado dos arquivos existentes, então
+		// isso exige uma nova catalog::VERSION e estes valores atualizados
+		static_assert( Instruction::ADD == 1 and Instruction::SUB == 2 and Instruction::MUL == 3
+			and Instruction::DIV == 4 and Instruction::MOD == 5 and Instruction::POW == 6,
+			"os códigos de operação gravados nos catálogos mudaram" );
+
+		/**
+		 * @brief      Faixa [lo, hi] de valores de um slot ou de um resultado
+		 */
+		struct Interval
+		{
+			value_type lo;
+			value_type hi;
+		};
+
+	private:
+
+		std::vector< Instruction > code;     // As instruções, em ordem posfixa
+		std::vector< Instruction > exact;    // As instruções analisadas para os literais originais
+		std::vector< value_type > constants; // O valor de cada slot na expressão original
+		size_type depth = 0;                 // Altura máxima da pilha durante a execução
+
+	public:
+
+		/**
+		 * @brief      Construtor padrão da Program ( programa vazio )
+		 */
+		Program() = default;
+
+		/**
+		 * @brief      Compila a expressão posfixa informada
+		 *
+		 * @param[in]  postfix  Expressão em notação posfixa
+		 */
+		explicit Program( const std::vector< Token > & postfix );
+
+		/**
+		 * @brief      Descarta o programa atual e compila a expressão posfixa
+		 *
+		 * @param[in]  postfix  Expressão em notação posfixa
+		 */
+		void compile( const std::vector< Token > & postfix );
+
+		/**
+		 * @brief      Executa o programa com os literais da expressão original
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix
+		 */
+		Evaluator::EvaluatorResult run( void ) const;
+
+		/**
+		 * @brief      Executa o programa com outros valores nos slots
+		 *
+		 * @param[in]  operands  Um valor por slot ( slot_count() valores ), cada um
+		 *                       dentro da faixa de Parser::required_int_type ( ou
+		 *                       do intervalo informado em assume() )
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix para a
+		 *             expressão com esses literais
+		 */
+		Evaluator::EvaluatorResult run( const value_type * operands ) const;
+
+		/**
+		 * @brief      Refaz a análise de faixas usadas por run( operands ),
+		 *             assumindo que cada slot fica dentro do intervalo informado
+		 *             ( por padrão, toda a faixa de Parser::required_int_type )
+		 *
+		 * @param[in]  bounds  Um intervalo por slot
+		 *
+		 * @return     Quantidade de operações que dispensam verificação
+		 */
+		size_type assume( const std::vector< Interval > & bounds );
+
+		/**
+		 * @brief      Executa uma sequência de instruções que não pertence a uma
+		 *             Program ( por exemplo, mapeada de um arquivo )
+		 *
+		 * @param[in]  code      As instruções, em ordem posfixa
+		 * @param[in]  n         Quantidade de instruções
+		 * @param[in]  operands  Um valor por slot
+		 * @param[in]  depth     Altura máxima da pilha durante a execução
+		 *
+		 * @return     O mesmo resultado de Evaluator::evaluate_postfix
+		 */
+		static Evaluator::EvaluatorResult execute( const Instruction * code, size_type n,
+			const value_type * operands, size_type depth );
+
+		/**
+		 * @brief      Recupera as instruções do programa
+		 *
+		 * @return     Vector com as instruções
+		 */
+		const std::vector< Instruction > & instructions( void ) const;
+
+		/**
+		 * @brief      Recupera os valores originais dos slots
+		 *
+		 * @return     Vector com um valor por slot
+		 */
+		const std::vector< value_type > & slots( void ) const;
+
+		/**
+		 * @brief      Informa quantos slots ( literais ) o programa possui
+		 *
+		 * @return     Número de slots
+		 */
+		size_type slot_count( void ) const;
+
+		/**
+		 * @brief      Informa a altura máxima da pilha durante a execução
+		 *
+		 * @return     Altura máxima da pilha
+		 */
+		size_type max_depth( void ) const;
+
+		/**
+		 * @brief      Converte o símbolo de um operador em código de operação
+		 *
+		 * @param[in]  c     Símbolo do operador ( precisa estar em
+		 *                   bares::OPERATORS )
+		 *
+		 * @return     O código de operação correspondente
+		 *
+		 * @throws     std::invalid_argument  Se o símbolo não for um operador
+		 */
+		static Instruction::opcode_t opcode_of( char c );
+
+		/**
+		 * @brief      Linha de bares::OPERATORS de um código de operação
+		 *
+		 * @param[in]  op    Código de operação ( diferente de PUSH, com ou sem
+		 *                   o bit UNCHECKED )
+		 *
+		 * @return     A descrição do operador
+		 */
+		static const bares::Operator & operator_of( Instruction::opcode_t op );
+
+		/**
+		 * @brief      Converte um código de operação no símbolo do operador
+		 *
+		 * @param[in]  op    Código de operação ( diferente de PUSH, com ou sem
+		 *                   o bit UNCHECKED )
+		 *
+		 * @return     O símbolo do operador
+		 */
+		static char symbol_of( Instruction::opcode_t op );
+};
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file range_analysis.hpp
+ * @brief      Declaração da classe RangeAnalysis
+ * @details    Análise de intervalos sobre as instruções de uma Program. A
+ *             partir da faixa de cada slot ( exata, para os literais da
+ *             expressão, ou informada por quem vai executar o programa ), o
+ *             intervalo de cada resultado intermediário é propagado em ordem
+ *             posfixa. Operações cujo resultado cabe, com certeza, em
+ *             Parser::required_int_type e cujo divisor nunca é zero recebem o
+ *             bit Instruction::UNCHECKED e passam a ser executadas sem os
+ *             testes de Evaluator::execute_operator.
+ *
+ *             Operações não provadas seguem verificadas; como uma operação
+ *             com erro empilha 0, o intervalo delas é a faixa possível unida
+ *             ao zero.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _RANGE_ANALYSIS_H_
+#define _RANGE_ANALYSIS_H_
+
+#include <cstddef>  	// std::size_t
+
+#include "program.hpp"	// Program::Instruction, Program::Interval
+
+/**
+ * @brief      Prova, por intervalos, quais operações dispensam verificação
+ */
+class RangeAnalysis
+{
+	public:
+
+		using value_type = Program::value_type;
+		using size_type = Program::size_type;
+		using Interval = Program::Interval;
+		using Instruction = Program::Instruction;
+
+		/**
+		 * @brief      Faixa de Parser::required_int_type
+		 *
+		 * @return     O intervalo de todos os valores que podem estar na pilha
+		 */
+		static Interval full_range( void );
+
+		/**
+		 * @brief      Intervalo do resultado de uma operação
+		 *
+		 * @param[in]  op    Código de operação ( sem o bit UNCHECKED )
+		 * @param[in]  a     Intervalo do primeiro termo
+		 * @param[in]  b     Intervalo do segundo termo
+		 * @param[out] safe  Se a operação nunca estoura nem divide por zero
+		 *
+		 * @return     O intervalo do valor empilhado pela operação
+		 */
+		static Interval apply( Instruction::opcode_t op, Interval a, Interval b, bool & safe );
+
+		/**
+		 * @brief      Marca com UNCHECKED as operações provadas seguras e
+		 *             limpa a marca das demais
+		 *
+		 * @param      code   As instruções, em ordem posfixa
+		 * @param[in]  n      Quantidade de instruções
+		 * @param[in]  slots  A faixa de cada slot
+		 *
+		 * @return     Quantidade de operações provadas seguras
+		 */
+		static size_type annotate( Instruction * code, size_type n, const Interval * slots );
+
+		/**
+		 * @brief      Marca as operações provadas seguras para valores exatos
+		 *             nos slots
+		 *
+		 * @param      code       As instruções, em ordem posfixa
+		 * @param[in]  n          Quantidade de instruções
+		 * @param[in]  constants  O valor de cada slot
+		 *
+		 * @return     Quantidade de operações provadas seguras
+		 */
+		static size_type annotate( Instruction * code, size_type n, const value_type * constants );
+};
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file result_cache.hpp
+ * @brief      Declaração dos métodos e atributos da classe ResultCache
+ * @details    Cache persistente de resultados: uma tabela hash de
+ *             endereçamento aberto em um arquivo mapeado com mmap, indexada
+ *             por um hash de 128 bits da expressão normalizada ( tabulações
+ *             viram espaços; os demais espaços são mantidos porque as colunas
+ *             dos erros dependem deles ). Cada posição guarda o valor ou os
+ *             códigos de erro e a coluna.
+ *
+ *             Apenas um processo escreve ( trava exclusiva com flock ); os
+ *             demais abrem o arquivo só para leitura. Cada posição tem um
+ *             contador de sequência ( seqlock ): o escritor o deixa ímpar
+ *             enquanto altera a posição, e um leitor que vê um valor ímpar
+ *             ou diferente antes e depois da leitura trata a posição como
+ *             ausente. O tamanho do arquivo é fixo; quando a janela de
+ *             sondagem de uma chave está cheia, a posição usada há mais
+ *             execuções é substituída.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _RESULT_CACHE_H_
+#define _RESULT_CACHE_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint64_t, std::uint32_t
+#include <string>   	// std::string
+
+#include "parser.hpp"   	// Parser::ParserResult
+#include "evaluator.hpp"	// Evaluator::EvaluatorResult
+
+namespace cache
+{
+	constexpr char MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'R', 'C', '\0' };
+	constexpr std::uint32_t VERSION = 1;
+
+	/**
+	 * @brief      Posições examinadas a partir da posição inicial da chave
+	 */
+	constexpr std::size_t PROBE = 16;
+
+	/**
+	 * @brief      Cabeçalho do arquivo ( 64 bytes )
+	 */
+	struct Header
+	{
+		char magic[8];                 // MAGIC
+		std::uint32_t version;         // VERSION
+		std::uint32_t slot_size;       // sizeof( Slot )
+		std::uint64_t capacity;        // Quantidade de posições ( potência de 2 )
+		std::uint32_t generation;      // Execuções do escritor, para a substituição
+		std::uint32_t reserved0;
+		std::uint64_t reserved[4];
+	};
+
+	/**
+	 * @brief      Uma posição da tabela ( 48 bytes )
+	 */
+	struct Slot
+	{
+		std::uint32_t seq;             // Seqlock: ímpar durante a escrita
+		std::uint32_t stamp;           // Geração do último uso ( 0: vazia )
+		std::uint64_t key[2];          // Hash de 128 bits da expressão
+		std::int64_t value;            // Valor, se não houve erro
+		std::int64_t at_col;           // Coluna do erro do Parser
+		std::uint8_t parser_code;      // Parser::ParserResult::code_t
+		std::uint8_t evaluator_code;   // Evaluator::EvaluatorResult::code_t
+		std::uint8_t reserved[6];
+	};
+}
+
+/**
+ * @brief      Tabela hash persistente de resultados de expressões
+ */
+class ResultCache
+{
+	public:
+
+		using size_type = std::size_t;
+
+		/**
+		 * @brief      Tamanho padrão do arquivo ao criá-lo
+		 */
+		static constexpr size_type DEFAULT_LIMIT = 64 << 20;
+
+		/**
+		 * @brief      Resultado guardado para uma expressão
+		 */
+		struct Result
+		{
+			Parser::ParserResult parsed;          // Resultado da análise
+			Evaluator::EvaluatorResult evaluated; // Resultado da avaliação, se parsed for PARSER_OK
+		};
+
+	private:
+
+		unsigned char * base = nullptr;       // Início do mapeamento
+		size_type length = 0;                 // Tamanho do mapeamento
+		cache::Header * header = nullptr;     // Cabeçalho mapeado
+		cache::Slot * slots = nullptr;        // Posições mapeadas
+		std::uint64_t mask = 0;               // capacity - 1
+		std::uint32_t generation = 0;         // Geração desta execução
+		int fd = -1;                          // Descritor ( mantém a trava )
+		bool writer = false;                  // Se este processo pode escrever
+
+		/**
+		 * @brief      Calcula o hash de 128 bits da expressão normalizada
+		 */
+		static void key_of( const std::string & expr, std::uint64_t key[2] );
+
+		/**
+		 * @brief      Cria um arquivo vazio com a capacidade que cabe no limite
+		 */
+		static std::string create( const std::string & path, size_type limit );
+
+	public:
+
+		/**
+		 * @brief      Construtor padrão ( cache fechado )
+		 */
+		ResultCache() = default;
+
+		/**
+		 * @brief      Destrutor, desfaz o mapeamento
+		 */
+		~ResultCache();
+
+		/**
+		 * @brief      Construtor cópia do ResultCache deletado
+		 *
+		 * @param[in]  other  O outro ResultCache
+		 */
+		ResultCache( const ResultCache & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro ResultCache
+		 *
+		 * @return     O novo ResultCache
+		 */
+		ResultCache & operator=( const ResultCache & other ) = delete;
+
+		/**
+		 * @brief      Abre ( ou cria ) o arquivo do cache
+		 *
+		 * @param[in]  path   Caminho do arquivo
+		 * @param[in]  limit  Tamanho máximo do arquivo, usado apenas ao criá-lo
+		 *
+		 * @return     Vazio se abriu, ou a descrição do erro
+		 */
+		std::string open( const std::string & path, size_type limit = DEFAULT_LIMIT );
+
+		/**
+		 * @brief      Desfaz o mapeamento e libera a trava
+		 */
+		void close( void );
+
+		/**
+		 * @brief      Procura o resultado de uma expressão
+		 *
+		 * @param[in]  expr  A expressão
+		 * @param[out] out   O resultado guardado
+		 *
+		 * @return     True se encontrou, False caso contrário
+		 */
+		bool lookup( const std::string & expr, Result & out );
+
+		/**
+		 * @brief      Guarda o resultado de uma expressão ( ignorado se este
+		 *             processo não é o escritor )
+		 *
+		 * @param[in]  expr    A expressão
+		 * @param[in]  result  O resultado
+		 */
+		void insert( const std::string & expr, const Result & result );
+
+		/**
+		 * @brief      Informa se este processo pode escrever no cache
+		 *
+		 * @return     True se possui a trava de escrita
+		 */
+		bool is_writer( void ) const;
+
+		/**
+		 * @brief      Informa quantas posições a tabela possui
+		 *
+		 * @return     A capacidade, 0 se o cache está fechado
+		 */
+		size_type capacity( void ) const;
+};
+
+#endif
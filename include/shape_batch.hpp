@@ -0,0 +1,111 @@
+/**
+ * @file shape_batch.hpp
+ * @brief      Declaração dos métodos e atributos da classe ShapeBatch
+ * @details    Avaliação em lote agrupada por formato. Linhas geradas por
+ *             máquina costumam repetir a mesma estrutura de tokens com
+ *             literais diferentes ( por exemplo "a * (b + c) - d" ). A
+ *             assinatura de uma linha é a sequência de tipos de token e
+ *             operadores emitida pelo Parser, com todo literal trocado por
+ *             '#'. Linhas com a mesma assinatura formam um grupo: a conversão
+ *             para posfixa e a compilação em Program acontecem uma vez por
+ *             grupo, e os literais do grupo são avaliados em faixas de LANES
+ *             linhas ao mesmo tempo, com instruções SIMD ( incluindo os testes
+ *             de estouro e de divisão por zero, feitos com máscaras ). Os
+ *             resultados voltam na ordem da entrada.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _SHAPE_BATCH_H_
+#define _SHAPE_BATCH_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::int32_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "token.hpp"    	// Token
+#include "parser.hpp"   	// Parser
+#include "evaluator.hpp"	// Evaluator
+#include "program.hpp"  	// Program
+
+/**
+ * @brief      Avaliador em lote que agrupa linhas com a mesma estrutura
+ */
+class ShapeBatch
+{
+	public:
+
+		using size_type = std::size_t;
+		using value_type = Evaluator::value_type;
+
+		/**
+		 * @brief      Quantidade de linhas avaliadas por instrução SIMD
+		 */
+		static constexpr size_type LANES = 8;
+
+		/**
+		 * @brief      Resultado de uma linha do lote
+		 */
+		struct LineResult
+		{
+			Parser::ParserResult parsed;        // Resultado da análise
+			Evaluator::EvaluatorResult evaluated; // Resultado da avaliação, se parsed for PARSER_OK
+		};
+
+	private:
+
+		/**
+		 * @brief      Um grupo de linhas com a mesma assinatura
+		 */
+		struct Shape
+		{
+			Program program;                     // Compilado uma vez por grupo
+			std::vector< size_type > lines;      // Índice de cada linha do grupo na entrada
+			std::vector< std::int32_t > operands;// Literais, linha após linha
+		};
+
+		Parser parser;
+		Evaluator evaluator;
+		size_type shapes = 0; // Quantidade de grupos do último lote
+
+		/**
+		 * @brief      Calcula a assinatura de uma lista de tokens
+		 *
+		 * @param[in]  tokens  Tokens emitidos pelo Parser
+		 *
+		 * @return     Tipos e operadores, com '#' no lugar de cada literal
+		 */
+		static std::string signature( const std::vector< Token > & tokens );
+
+		/**
+		 * @brief      Avalia todas as linhas de um grupo, LANES por vez
+		 *
+		 * @param[in]  shape    O grupo
+		 * @param      results  Onde gravar o resultado de cada linha
+		 */
+		static void run_lanes( const Shape & shape, std::vector< LineResult > & results );
+
+	public:
+
+		/**
+		 * @brief      Avalia um lote de expressões
+		 *
+		 * @param[in]  lines  As expressões, uma por linha
+		 *
+		 * @return     Um resultado por linha, na ordem da entrada, iguais aos de
+		 *             Parser::parse e Evaluator::evaluate_postfix
+		 */
+		std::vector< LineResult > evaluate( const std::vector< std::string > & lines );
+
+		/**
+		 * @brief      Informa quantos grupos o último lote formou
+		 *
+		 * @return     Quantidade de grupos
+		 */
+		size_type shape_count( void ) const;
+};
+
+#endif
@@ -0,0 +1,172 @@
+/**
+ * @file shard_manifest.hpp
+ * @brief      Divisão de uma entrada em partes para execuções distribuídas
+ * @details    Uma entrada grande é dividida em partes ( shards ) nos limites
+ *             das linhas pelo "bin/shard_split", cada parte é avaliada por um
+ *             processo "bares --shard" independente ( na mesma máquina ou em
+ *             outra ) e as saídas são juntadas na ordem original pelo
+ *             "bin/shard_merge".
+ *
+ *             As partes são equilibradas pelo custo estimado das linhas, não
+ *             pela quantidade: cada linha custa o seu tamanho mais um peso por
+ *             token ( operadores, parênteses e números ), que é o que domina a
+ *             análise e a avaliação.
+ *
+ *             O manifesto ( texto ) descreve cada parte com a primeira linha,
+ *             a quantidade de linhas, os bytes e o checksum. Ao terminar, o
+ *             "bares --shard" grava ao lado da saída um registro ".done" com
+ *             as linhas, os bytes e o checksum da saída, e o shard_merge só
+ *             junta partes cujos registros conferem com o manifesto e com os
+ *             arquivos.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _SHARD_MANIFEST_H_
+#define _SHARD_MANIFEST_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint64_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+namespace sharding
+{
+	/**
+	 * @brief      Peso de cada token no custo de uma linha
+	 */
+	constexpr std::uint64_t TOKEN_WEIGHT = 4;
+
+	/**
+	 * @brief      Uma parte da entrada
+	 */
+	struct Shard
+	{
+		std::string file;             // Nome do arquivo, relativo ao diretório do manifesto
+		std::uint64_t first_line = 0; // Índice ( a partir de 0 ) da primeira linha na entrada
+		std::uint64_t lines = 0;
+		std::uint64_t bytes = 0;
+		std::uint64_t cost = 0;       // Custo estimado
+		std::uint64_t checksum = 0;   // FNV-1a do conteúdo
+	};
+
+	/**
+	 * @brief      Descrição de uma divisão
+	 */
+	struct Manifest
+	{
+		std::string input;            // Arquivo dividido
+		std::uint64_t lines = 0;      // Linhas avaliadas ( até "q"/"p" )
+		std::uint64_t bytes = 0;
+		std::vector< Shard > shards;
+	};
+
+	/**
+	 * @brief      Resultado de uma parte, gravado pelo "bares --shard"
+	 */
+	struct Done
+	{
+		std::uint64_t lines = 0;      // Linhas da saída ( uma por linha da entrada )
+		std::uint64_t bytes = 0;
+		std::uint64_t checksum = 0;   // FNV-1a da saída
+	};
+
+	/**
+	 * @brief      FNV-1a de 64 bits, calculado aos pedaços
+	 */
+	class Checksum
+	{
+		private:
+
+			std::uint64_t h = 14695981039346656037ull;
+
+		public:
+
+			/**
+			 * @brief      Acrescenta bytes
+			 *
+			 * @param[in]  data  Os bytes
+			 * @param[in]  n     Quantidade de bytes
+			 */
+			void update( const char * data, std::size_t n );
+
+			/**
+			 * @brief      O checksum dos bytes vistos até agora
+			 */
+			std::uint64_t value( void ) const;
+	};
+
+	/**
+	 * @brief      Estima o custo de avaliar uma linha
+	 *
+	 * @param[in]  line  A linha, sem o '\n'
+	 * @param[in]  n     Tamanho
+	 *
+	 * @return     Bytes mais TOKEN_WEIGHT por token
+	 */
+	std::uint64_t line_cost( const char * line, std::size_t n );
+
+	/**
+	 * @brief      Conta as linhas e os bytes de um arquivo e calcula o checksum
+	 *
+	 * @param[in]  path     Caminho
+	 * @param[out] summary  Linhas ( '\n' ), bytes e checksum
+	 *
+	 * @return     Vazio se leu, ou a descrição do erro
+	 */
+	std::string scan_file( const std::string & path, Done & summary );
+
+	/**
+	 * @brief      Caminho de um arquivo de parte
+	 *
+	 * @param[in]  manifest  Caminho do manifesto
+	 * @param[in]  file      Nome gravado no manifesto
+	 *
+	 * @return     O caminho, no diretório do manifesto
+	 */
+	std::string resolve( const std::string & manifest, const std::string & file );
+
+	/**
+	 * @brief      Grava o manifesto
+	 *
+	 * @param[in]  path      Caminho
+	 * @param[in]  manifest  O manifesto
+	 *
+	 * @return     Vazio se gravou, ou a descrição do erro
+	 */
+	std::string write_manifest( const std::string & path, const Manifest & manifest );
+
+	/**
+	 * @brief      Lê o manifesto
+	 *
+	 * @param[in]  path      Caminho
+	 * @param[out] manifest  O manifesto
+	 *
+	 * @return     Vazio se leu, ou a descrição do erro
+	 */
+	std::string read_manifest( const std::string & path, Manifest & manifest );
+
+	/**
+	 * @brief      Grava o registro de uma parte concluída ( de forma atômica )
+	 *
+	 * @param[in]  path  Caminho
+	 * @param[in]  done  O registro
+	 *
+	 * @return     Vazio se gravou, ou a descrição do erro
+	 */
+	std::string write_done( const std::string & path, const Done & done );
+
+	/**
+	 * @brief      Lê o registro de uma parte concluída
+	 *
+	 * @param[in]  path  Caminho
+	 * @param[out] done  O registro
+	 *
+	 * @return     Vazio se leu, ou a descrição do erro
+	 */
+	std::string read_done( const std::string & path, Done & done );
+}
+
+#endif
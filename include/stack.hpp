@@ -14,6 +14,8 @@
 
 #include <list>
 
+#include "alloc_stats.hpp"	// BARES_ALLOC_STACK
+
 namespace jv
 {
 	template < typename T >
@@ -129,6 +131,7 @@ namespace jv
 		}
 		m_storage.push_back( valor );
 		++m_top;
+		BARES_ALLOC_STACK( m_top );
 
 	}
 
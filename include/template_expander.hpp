@@ -0,0 +1,106 @@
+/**
+ * @file template_expander.hpp
+ * @brief      Declaração dos métodos e atributos da classe TemplateExpander
+ * @details    Modo de modelos do bares ( "bares --template" ): um documento
+ *             qualquer é lido em blocos e cada trecho "${expressão}" é
+ *             substituído pelo seu valor, calculado pelo Parser e pelo
+ *             Evaluator. O texto entre os trechos é copiado para a saída em
+ *             pedaços inteiros: o próximo '$' é procurado com memchr, que a
+ *             glibc implementa com instruções vetoriais, então nenhum byte
+ *             comum é tratado individualmente.
+ *
+ *             Um trecho termina no primeiro '}' e não pode conter '\n'; um
+ *             "${" sem fechamento na mesma linha é copiado como texto. Trechos
+ *             com erro também são copiados sem alteração e o erro é informado
+ *             com a posição do '$' no documento e a coluna dentro do trecho.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _TEMPLATE_EXPANDER_H_
+#define _TEMPLATE_EXPANDER_H_
+
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint64_t
+#include <string>   	// std::string
+
+#include "output_writer.hpp"	// OutputWriter
+#include "parser.hpp"       	// Parser
+#include "evaluator.hpp"    	// Evaluator
+
+/**
+ * @brief      Substitui as expressões embutidas em um documento
+ */
+class TemplateExpander
+{
+	public:
+
+		using size_type = std::size_t;
+
+	private:
+
+		OutputWriter & out;       // Documento resultante
+		OutputWriter & errors;    // Uma linha por trecho com erro
+		Parser parser;
+		Evaluator evaluator;
+		std::string pending;      // Início de um trecho cortado pelo fim do bloco
+		std::uint64_t offset = 0; // Posição no documento do primeiro byte do próximo bloco
+		std::uint64_t expanded = 0;
+		std::uint64_t failed = 0;
+
+		/**
+		 * @brief      Avalia um trecho e escreve o valor ( ou o trecho original,
+		 *             se houver erro )
+		 *
+		 * @param[in]  start  Início do trecho, no '$'
+		 * @param[in]  end    Depois do '}'
+		 * @param[in]  at     Posição do '$' no documento
+		 */
+		void expand( const char * start, const char * end, std::uint64_t at );
+
+		/**
+		 * @brief      Processa bytes que começam fora de um trecho
+		 *
+		 * @param[in]  p     Início
+		 * @param[in]  end   Fim
+		 * @param[in]  at    Posição de p no documento
+		 */
+		void scan( const char * p, const char * end, std::uint64_t at );
+
+	public:
+
+		/**
+		 * @brief      Construtor do TemplateExpander
+		 *
+		 * @param      out_     Onde escrever o documento
+		 * @param      errors_  Onde escrever os erros
+		 */
+		TemplateExpander( OutputWriter & out_, OutputWriter & errors_ );
+
+		/**
+		 * @brief      Processa o próximo bloco do documento
+		 *
+		 * @param[in]  data  Os bytes
+		 * @param[in]  n     Quantidade de bytes
+		 */
+		void feed( const char * data, size_type n );
+
+		/**
+		 * @brief      Encerra o documento, copiando um trecho inacabado
+		 */
+		void finish( void );
+
+		/**
+		 * @brief      Quantidade de trechos substituídos
+		 */
+		std::uint64_t expanded_count( void ) const;
+
+		/**
+		 * @brief      Quantidade de trechos com erro
+		 */
+		std::uint64_t error_count( void ) const;
+};
+
+#endif
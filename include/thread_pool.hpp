@@ -0,0 +1,220 @@
+/**
+ * @file thread_pool.hpp
+ * @brief      Declaração dos métodos e atributos da classe ThreadPool
+ * @details    Pool de threads com roubo de tarefas ( work-stealing ): cada
+ *             thread tem sua própria fila, retira tarefas do fim dela e, quando
+ *             fica sem trabalho, rouba do início da fila de outra thread. A
+ *             thread que chama wait() também executa tarefas até as que ela
+ *             espera terminarem.
+ *
+ *             Cada tarefa pertence a um Group ( um lote ), e wait( group )
+ *             espera apenas as tarefas desse lote. Assim, uma tarefa pode
+ *             submeter um sub-lote e esperar por ele sem esperar a si mesma.
+ *             Threads sem trabalho dormem em uma condition_variable e são
+ *             acordadas a cada submissão ou quando um lote termina.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+#include <atomic>   	// std::atomic
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>  	// std::size_t
+#include <deque>    	// std::deque
+#include <functional>	// std::function
+#include <memory>   	// std::unique_ptr
+#include <mutex>    	// std::mutex
+#include <thread>   	// std::thread
+#include <vector>   	// std::vector
+
+/**
+ * @brief      Pool de threads com roubo de tarefas
+ */
+class ThreadPool
+{
+	public:
+
+		using task_type = std::function< void() >;
+
+		/**
+		 * @brief      Lote de tarefas esperado em conjunto por wait( group )
+		 */
+		class Group
+		{
+			private:
+
+				friend class ThreadPool;
+
+				std::atomic< std::size_t > pending; // Tarefas do lote ainda não concluídas
+
+			public:
+
+				/**
+				 * @brief      Cria um lote vazio
+				 */
+				Group() : pending( 0 ) {}
+
+				/**
+				 * @brief      Construtor cópia do Group deletado
+				 *
+				 * @param[in]  other  O outro Group
+				 */
+				Group( const Group & other ) = delete;
+
+				/**
+				 * @brief      Sobrecarga do operador = deletado
+				 *
+				 * @param[in]  other  O outro Group
+				 *
+				 * @return     O novo Group
+				 */
+				Group & operator=( const Group & other ) = delete;
+		};
+
+	private:
+
+		/**
+		 * @brief      Uma tarefa e o lote a que pertence
+		 */
+		struct Job
+		{
+			task_type task;
+			Group * group;
+		};
+
+		/**
+		 * @brief      Fila de tarefas de uma thread
+		 */
+		struct Queue
+		{
+			std::mutex lock;
+			std::deque< Job > jobs;
+		};
+
+		std::vector< std::unique_ptr< Queue > > queues; // Uma fila por thread, mais a de quem chama
+		std::vector< std::thread > workers;             // As threads do pool
+		Group all;                                      // Lote de submit( task ) e wait()
+		std::atomic< std::size_t > pending;             // Tarefas submetidas e ainda não concluídas, de todos os lotes
+		std::atomic< std::size_t > queued;              // Tarefas ainda nas filas
+		std::atomic< std::size_t > next_queue;          // Distribuição round-robin das submissões
+		std::atomic< bool > stopping;                   // Pedido de encerramento
+
+		std::mutex sleep_lock;                          // Protege o sono das threads ociosas
+		std::condition_variable wake;                   // Acorda threads quando há tarefas ou um lote termina
+
+		/**
+		 * @brief      Tenta obter uma tarefa, primeiro da própria fila e depois
+		 *             roubando das demais
+		 *
+		 * @param[in]  self  Índice da fila da thread
+		 * @param[out] job   A tarefa obtida
+		 *
+		 * @return     True se obteve uma tarefa, False caso contrário
+		 */
+		bool take( std::size_t self, Job & job );
+
+		/**
+		 * @brief      Executa uma tarefa e avisa quem espera se o lote dela
+		 *             ( ou o pool inteiro ) terminou
+		 *
+		 * @param      job   A tarefa
+		 */
+		void run( Job & job );
+
+		/**
+		 * @brief      Executa tarefas na thread atual até o contador zerar,
+		 *             dormindo enquanto não há tarefas nas filas
+		 *
+		 * @param[in]  counter  Tarefas ainda não concluídas que são esperadas
+		 */
+		void help_until_done( const std::atomic< std::size_t > & counter );
+
+		/**
+		 * @brief      Índice da fila da thread atual neste pool ( 0 se ela não
+		 *             é uma thread do pool )
+		 *
+		 * @return     O índice
+		 */
+		std::size_t own_queue( void ) const;
+
+		/**
+		 * @brief      Laço principal de cada thread do pool
+		 *
+		 * @param[in]  self  Índice da fila da thread
+		 */
+		void work( std::size_t self );
+
+	public:
+
+		/**
+		 * @brief      Cria o pool
+		 *
+		 * @param[in]  threads  Quantidade de threads; 0 usa o número de núcleos
+		 */
+		explicit ThreadPool( std::size_t threads = 0 );
+
+		/**
+		 * @brief      Destrutor, espera as tarefas pendentes de todos os lotes e
+		 *             encerra as threads
+		 */
+		~ThreadPool();
+
+		/**
+		 * @brief      Construtor cópia do ThreadPool deletado
+		 *
+		 * @param[in]  other  O outro ThreadPool
+		 */
+		ThreadPool( const ThreadPool & other ) = delete;
+
+		/**
+		 * @brief      Sobrecarga do operador = deletado
+		 *
+		 * @param[in]  other  O outro ThreadPool
+		 *
+		 * @return     O novo ThreadPool
+		 */
+		ThreadPool & operator=( const ThreadPool & other ) = delete;
+
+		/**
+		 * @brief      Submete uma tarefa ao lote padrão do pool
+		 *
+		 * @param[in]  task  A tarefa
+		 */
+		void submit( task_type task );
+
+		/**
+		 * @brief      Submete uma tarefa a um lote
+		 *
+		 * @param      group  O lote, que precisa existir até wait( group )
+		 * @param[in]  task   A tarefa
+		 */
+		void submit( Group & group, task_type task );
+
+		/**
+		 * @brief      Executa tarefas na thread atual até as tarefas do lote
+		 *             padrão terminarem
+		 */
+		void wait( void );
+
+		/**
+		 * @brief      Executa tarefas na thread atual até as tarefas do lote
+		 *             terminarem; pode ser chamado de dentro de uma tarefa
+		 *
+		 * @param      group  O lote
+		 */
+		void wait( Group & group );
+
+		/**
+		 * @brief      Informa quantas threads executam tarefas, incluindo a
+		 *             thread que chama wait()
+		 *
+		 * @return     Quantidade de threads
+		 */
+		std::size_t size( void ) const;
+};
+
+#endif
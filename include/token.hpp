@@ -13,6 +13,7 @@
 
 #include <string>   // std::string
 #include <iostream> // std::ostream
+#include <cstddef>  // std::ptrdiff_t
 
 /**
  * @brief      Struct que representa um Token, isto é, informa qual é o valor do
@@ -33,18 +34,21 @@ struct Token
 			OPENING_SCOPE   // "("
 		};
 
-		std::string value; // O valor do Token
-		token_t type;      // O tipo do Token
+		std::string value;  // O valor do Token
+		token_t type;       // O tipo do Token
+		std::ptrdiff_t col; // A coluna onde o Token começa na expressão
 
 		/**
 		 * @brief      Construtor de um Token
 		 *
 		 * @param[in]  v_    O Valor do Token
 		 * @param[in]  t_    O tipo do Token
+		 * @param[in]  c_    A coluna onde o Token começa
 		 */
-		explicit Token( std::string v_="", token_t t_ = token_t::OPERAND )
+		explicit Token( std::string v_="", token_t t_ = token_t::OPERAND, std::ptrdiff_t c_ = 0 )
 			: value( v_ )
 			, type( t_ )
+			, col( c_ )
 		{/* Vazio */}
 
 		/**
@@ -0,0 +1,137 @@
+/**
+ * @file traffic_log.hpp
+ * @brief      Declaração dos métodos e atributos das classes TrafficRecorder e
+ *             TrafficLog
+ * @details    Registro binário das linhas recebidas pelo bares, com o instante
+ *             de chegada de cada uma, para reproduzir o tráfego depois (
+ *             bench/replay.cpp ).
+ *
+ *             Formato ( inteiros little-endian ):
+ *
+ *                 Header  { magic[8], version, reserved }      16 bytes
+ *                 Record  { varint delta_ns, varint length, bytes }...
+ *
+ *             delta_ns é o tempo desde a linha anterior ( ou desde o início
+ *             da gravação ) e length o tamanho da linha, sem o '\n'. Um
+ *             registro incompleto no fim ( gravação interrompida ) é ignorado
+ *             na leitura.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#ifndef _TRAFFIC_LOG_H_
+#define _TRAFFIC_LOG_H_
+
+#include <chrono>   	// std::chrono::steady_clock
+#include <cstddef>  	// std::size_t
+#include <cstdint>  	// std::uint64_t, std::uint32_t
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include "output_writer.hpp"	// OutputWriter
+
+namespace traffic
+{
+	constexpr char MAGIC[8] = { 'B', 'A', 'R', 'E', 'S', 'T', 'L', '\0' };
+	constexpr std::uint32_t VERSION = 1;
+
+	/**
+	 * @brief      Cabeçalho do arquivo ( 16 bytes )
+	 */
+	struct Header
+	{
+		char magic[8];           // MAGIC
+		std::uint32_t version;   // VERSION
+		std::uint32_t reserved;
+	};
+
+	/**
+	 * @brief      Uma linha recebida
+	 */
+	struct Record
+	{
+		std::uint64_t at_ns;     // Instante de chegada, desde o início da gravação
+		std::string line;        // A linha, sem o '\n'
+	};
+}
+
+/**
+ * @brief      Grava as linhas recebidas, com o instante de chegada
+ */
+class TrafficRecorder
+{
+	private:
+
+		using clock_type = std::chrono::steady_clock;
+
+		OutputWriter out;           // Buffer de escrita do registro
+		clock_type::time_point start; // Início da gravação
+		std::uint64_t last = 0;     // Instante da linha anterior
+
+		/**
+		 * @brief      Escreve um inteiro com 7 bits por byte
+		 */
+		void write_varint( std::uint64_t v );
+
+	public:
+
+		/**
+		 * @brief      Construtor do TrafficRecorder, escreve o cabeçalho
+		 *
+		 * @param[in]  fd    Descritor do arquivo do registro
+		 */
+		explicit TrafficRecorder( int fd );
+
+		/**
+		 * @brief      Registra uma linha que acabou de chegar
+		 *
+		 * @param[in]  line  A linha, sem o '\n'
+		 */
+		void record( const std::string & line );
+
+		/**
+		 * @brief      Descarrega o que ainda está no buffer
+		 *
+		 * @return     True se todas as escritas deram certo
+		 */
+		bool flush( void );
+};
+
+/**
+ * @brief      Registro de tráfego carregado de um arquivo
+ */
+class TrafficLog
+{
+	private:
+
+		std::vector< traffic::Record > entries;
+
+	public:
+
+		/**
+		 * @brief      Carrega um registro gravado pelo TrafficRecorder
+		 *
+		 * @param[in]  path  Caminho do arquivo
+		 *
+		 * @return     Vazio se carregou, ou a descrição do erro
+		 */
+		std::string open( const std::string & path );
+
+		/**
+		 * @brief      Recupera as linhas na ordem de chegada
+		 *
+		 * @return     As linhas e seus instantes
+		 */
+		const std::vector< traffic::Record > & records( void ) const;
+
+		/**
+		 * @brief      Informa a duração da gravação
+		 *
+		 * @return     Instante da última linha, em nanossegundos
+		 */
+		std::uint64_t duration_ns( void ) const;
+};
+
+#endif
@@ -0,0 +1,276 @@
+/**
+ * @file aggregate.cpp
+ * @brief      Implementação dos métodos da classe Aggregate
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <sstream>  	// std::istringstream
+
+#include "aggregate.hpp"
+
+constexpr int Aggregate::PARSER_CODES;
+constexpr int Aggregate::EVALUATOR_CODES;
+constexpr int Aggregate::MAGNITUDES;
+constexpr int Aggregate::BUCKETS;
+
+namespace
+{
+	const char * const PARSER_NAMES[ Aggregate::PARSER_CODES ] =
+	{
+		"ok", "unexpected_end_of_expression", "ill_formed_integer", "missing_term",
+		"extraneous_symbol", "missing_closing_parenthesis", "integer_out_of_range"
+	};
+
+	const char * const EVALUATOR_NAMES[ Aggregate::EVALUATOR_CODES ] =
+	{
+		"ok", "division_by_zero", "numeric_overflow"
+	};
+
+	/**
+	 * @brief      Formata o acumulador de 128 bits em base 10
+	 *
+	 * @param[in]  v     O valor
+	 *
+	 * @return     O texto
+	 */
+	std::string to_string( Aggregate::wide_type v )
+	{
+		__extension__ typedef unsigned __int128 unsigned_wide;
+
+		bool negative = v < 0;
+		unsigned_wide u = negative ? 0 - static_cast< unsigned_wide >( v ) : static_cast< unsigned_wide >( v );
+
+		std::string digits;
+		do
+		{
+			digits.insert( digits.begin(), static_cast< char >( '0' + static_cast< int >( u % 10 ) ) );
+			u /= 10;
+		} while ( u != 0 );
+
+		return negative ? "-" + digits : digits;
+	}
+
+	/**
+	 * @brief      Expoente k tal que 2^k <= m < 2^(k+1)
+	 */
+	int magnitude( unsigned long long m )
+	{
+		return 63 - __builtin_clzll( m );
+	}
+}
+
+/**
+ * @brief      Faixa do histograma de um valor
+ *
+ * @param[in]  v     O valor
+ *
+ * @return     Índice da faixa
+ */
+int Aggregate::bucket_of( value_type v )
+{
+	if ( v == 0 )
+	{
+		return MAGNITUDES;
+	}
+
+	unsigned long long m = v < 0 ? 0ull - static_cast< unsigned long long >( v ) : static_cast< unsigned long long >( v );
+	int k = magnitude( m );
+
+	return v < 0 ? MAGNITUDES - 1 - k : MAGNITUDES + 1 + k;
+}
+
+/**
+ * @brief      Acumula o resultado de uma linha
+ *
+ * @param[in]  r     O resultado
+ */
+void Aggregate::add( const Engine::Result & r )
+{
+	++lines;
+
+	if ( r.parsed.type != Parser::ParserResult::PARSER_OK )
+	{
+		++parser_errors[ r.parsed.type ];
+		return;
+	}
+	if ( r.evaluated.type != Evaluator::EvaluatorResult::RESULT_OK )
+	{
+		++evaluator_errors[ r.evaluated.type ];
+		return;
+	}
+
+	auto v = r.evaluated.value;
+
+	min = values == 0 or v < min ? v : min;
+	max = values == 0 or v > max ? v : max;
+	sum += v;
+	++values;
+	++histogram[ bucket_of( v ) ];
+}
+
+/**
+ * @brief      Combina outro parcial com este
+ *
+ * @param[in]  other  O outro parcial
+ */
+void Aggregate::merge( const Aggregate & other )
+{
+	if ( other.values != 0 )
+	{
+		min = values == 0 or other.min < min ? other.min : min;
+		max = values == 0 or other.max > max ? other.max : max;
+	}
+
+	lines += other.lines;
+	values += other.values;
+	sum += other.sum;
+
+	for ( int i = 0; i < PARSER_CODES; ++i )
+	{
+		parser_errors[ i ] += other.parser_errors[ i ];
+	}
+	for ( int i = 0; i < EVALUATOR_CODES; ++i )
+	{
+		evaluator_errors[ i ] += other.evaluator_errors[ i ];
+	}
+	for ( int i = 0; i < BUCKETS; ++i )
+	{
+		histogram[ i ] += other.histogram[ i ];
+	}
+}
+
+/**
+ * @brief      Escreve os redutores pedidos, um por linha
+ *
+ * @param      os        Onde escrever
+ * @param[in]  reducers  Combinação de reducer_t
+ */
+void Aggregate::write( std::ostream & os, unsigned reducers ) const
+{
+	os << "lines: " << lines << "\n";
+	os << "values: " << values << "\n";
+
+	if ( reducers & SUM )
+	{
+		os << "sum: " << to_string( sum ) << "\n";
+	}
+	if ( reducers & MIN )
+	{
+		if ( values == 0 )
+		{
+			os << "min: -\n";
+		}
+		else
+		{
+			os << "min: " << min << "\n";
+		}
+	}
+	if ( reducers & MAX )
+	{
+		if ( values == 0 )
+		{
+			os << "max: -\n";
+		}
+		else
+		{
+			os << "max: " << max << "\n";
+		}
+	}
+	if ( reducers & COUNT )
+	{
+		os << "count ok: " << values << "\n";
+		for ( int i = 1; i < PARSER_CODES; ++i )
+		{
+			os << "count " << PARSER_NAMES[ i ] << ": " << parser_errors[ i ] << "\n";
+		}
+		for ( int i = 1; i < EVALUATOR_CODES; ++i )
+		{
+			os << "count " << EVALUATOR_NAMES[ i ] << ": " << evaluator_errors[ i ] << "\n";
+		}
+	}
+	if ( reducers & HISTOGRAM )
+	{
+		for ( int i = 0; i < BUCKETS; ++i )
+		{
+			if ( histogram[ i ] == 0 )
+			{
+				continue;
+			}
+
+			os << "histogram ";
+			if ( i == MAGNITUDES )
+			{
+				os << "[0, 0]";
+			}
+			else
+			{
+				int k = i < MAGNITUDES ? MAGNITUDES - 1 - i : i - MAGNITUDES - 1;
+				// Limites em unsigned: 2^63 não cabe em um valor com sinal
+				unsigned long long low = 1ull << k;
+				unsigned long long high = low + ( low - 1 );
+
+				if ( i < MAGNITUDES )
+				{
+					os << "[-" << high << ", -" << low << "]";
+				}
+				else
+				{
+					os << "[" << low << ", " << high << "]";
+				}
+			}
+			os << ": " << histogram[ i ] << "\n";
+		}
+	}
+}
+
+/**
+ * @brief      Converte uma lista de nomes em redutores
+ *
+ * @param[in]  list      A lista, separada por vírgulas
+ * @param[out] reducers  Combinação de reducer_t
+ *
+ * @return     False se algum nome é desconhecido
+ */
+bool Aggregate::parse_reducers( const std::string & list, unsigned & reducers )
+{
+	std::istringstream names( list );
+	std::string name;
+
+	reducers = 0;
+	while ( std::getline( names, name, ',' ) )
+	{
+		if ( name == "all" )
+		{
+			reducers |= ALL;
+		}
+		else if ( name == "sum" )
+		{
+			reducers |= SUM;
+		}
+		else if ( name == "min" )
+		{
+			reducers |= MIN;
+		}
+		else if ( name == "max" )
+		{
+			reducers |= MAX;
+		}
+		else if ( name == "count" )
+		{
+			reducers |= COUNT;
+		}
+		else if ( name == "histogram" )
+		{
+			reducers |= HISTOGRAM;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return reducers != 0;
+}
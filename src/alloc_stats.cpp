@@ -0,0 +1,199 @@
+/**
+ * @file alloc_stats.cpp
+ * @brief      Implementação da contabilidade de alocações
+ * @details    Vazio se BARES_ALLOC_STATS não estiver definido.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include "alloc_stats.hpp"
+
+#if defined( BARES_ALLOC_STATS )
+
+#include <atomic>   	// std::atomic
+#include <cstdint>  	// std::uint64_t
+#include <cstdlib>  	// std::malloc, std::free
+#include <iomanip>  	// std::setw
+#include <new>      	// std::bad_alloc
+
+#include <malloc.h>     	// malloc_usable_size
+#include <sys/resource.h>	// getrusage
+
+namespace
+{
+	using counter = std::atomic< std::uint64_t >;
+
+	const char * const STAGE_NAMES[ alloc_stats::STAGE_COUNT ] =
+		{ "other", "input", "parse", "postfix", "evaluate", "output" };
+
+	// Sem construtores dinâmicos: tudo pode ser usado antes de main
+	counter allocations[ alloc_stats::STAGE_COUNT ];
+	counter requested[ alloc_stats::STAGE_COUNT ];
+	counter live{ 0 };
+	counter peak{ 0 };
+	counter max_tokens{ 0 };
+	counter max_stack{ 0 };
+
+	// Por linha ( só a thread que chama end_line )
+	std::uint64_t lines = 0;
+	std::uint64_t line_start_allocations = 0;
+	std::uint64_t line_start_bytes = 0;
+	std::uint64_t max_line_allocations = 0;
+	std::uint64_t max_line_bytes = 0;
+
+	thread_local alloc_stats::stage_t current = alloc_stats::OTHER;
+
+	/**
+	 * @brief      Guarda o maior valor visto em um contador
+	 */
+	void raise( counter & c, std::uint64_t value )
+	{
+		auto seen = c.load( std::memory_order_relaxed );
+		while ( value > seen and not c.compare_exchange_weak( seen, value, std::memory_order_relaxed ) )
+		{
+			/* Vazio */
+		}
+	}
+
+	/**
+	 * @brief      Soma de um conjunto de contadores
+	 */
+	std::uint64_t total( const counter ( & c )[ alloc_stats::STAGE_COUNT ] )
+	{
+		std::uint64_t sum = 0;
+		for ( const auto & v : c )
+		{
+			sum += v.load( std::memory_order_relaxed );
+		}
+		return sum;
+	}
+
+	/**
+	 * @brief      Aloca e contabiliza
+	 */
+	void * counted_alloc( std::size_t n )
+	{
+		void * p = std::malloc( n == 0 ? 1 : n );
+		if ( p == nullptr )
+		{
+			throw std::bad_alloc();
+		}
+
+		allocations[ current ].fetch_add( 1, std::memory_order_relaxed );
+		requested[ current ].fetch_add( n, std::memory_order_relaxed );
+		raise( peak, live.fetch_add( malloc_usable_size( p ), std::memory_order_relaxed ) + malloc_usable_size( p ) );
+
+		return p;
+	}
+
+	/**
+	 * @brief      Libera e contabiliza
+	 */
+	void counted_free( void * p )
+	{
+		if ( p != nullptr )
+		{
+			live.fetch_sub( malloc_usable_size( p ), std::memory_order_relaxed );
+			std::free( p );
+		}
+	}
+}
+
+void * operator new( std::size_t n ) { return counted_alloc( n ); }
+void * operator new[]( std::size_t n ) { return counted_alloc( n ); }
+void operator delete( void * p ) noexcept { counted_free( p ); }
+void operator delete[]( void * p ) noexcept { counted_free( p ); }
+void operator delete( void * p, std::size_t ) noexcept { counted_free( p ); }
+void operator delete[]( void * p, std::size_t ) noexcept { counted_free( p ); }
+
+/**
+ * @brief      Muda a etapa da thread atual
+ *
+ * @param[in]  stage  A nova etapa
+ */
+void alloc_stats::set_stage( stage_t stage )
+{
+	current = stage;
+}
+
+/**
+ * @brief      Registra a quantidade de tokens de uma expressão
+ *
+ * @param[in]  n     Tokens
+ */
+void alloc_stats::note_tokens( std::size_t n )
+{
+	raise( max_tokens, n );
+}
+
+/**
+ * @brief      Registra a altura de uma jv::stack
+ *
+ * @param[in]  n     Elementos na pilha
+ */
+void alloc_stats::note_stack( std::size_t n )
+{
+	raise( max_stack, n );
+}
+
+/**
+ * @brief      Encerra uma linha, para os números por linha
+ */
+void alloc_stats::end_line( void )
+{
+	// O que foi alocado fora das etapas ( buffers, pools ) não é de nenhuma linha
+	auto a = total( allocations ) - allocations[ OTHER ].load( std::memory_order_relaxed );
+	auto b = total( requested ) - requested[ OTHER ].load( std::memory_order_relaxed );
+
+	if ( a - line_start_allocations > max_line_allocations )
+	{
+		max_line_allocations = a - line_start_allocations;
+	}
+	if ( b - line_start_bytes > max_line_bytes )
+	{
+		max_line_bytes = b - line_start_bytes;
+	}
+
+	line_start_allocations = a;
+	line_start_bytes = b;
+	++lines;
+}
+
+/**
+ * @brief      Escreve o relatório
+ *
+ * @param      os    Onde escrever
+ */
+void alloc_stats::report( std::ostream & os )
+{
+	rusage usage;
+	getrusage( RUSAGE_SELF, &usage );
+
+	double per_line = lines == 0 ? 0 : 1.0 / lines;
+
+	os << "allocation accounting: " << lines << " lines\n";
+	os << std::setw( 10 ) << "stage" << std::setw( 14 ) << "allocations" << std::setw( 16 ) << "bytes"
+		<< std::setw( 14 ) << "allocs/line" << std::setw( 14 ) << "bytes/line" << "\n";
+
+	for ( int s = 0; s < STAGE_COUNT; ++s )
+	{
+		auto a = allocations[ s ].load( std::memory_order_relaxed );
+		auto b = requested[ s ].load( std::memory_order_relaxed );
+
+		os << std::setw( 10 ) << STAGE_NAMES[ s ] << std::setw( 14 ) << a << std::setw( 16 ) << b
+			<< std::fixed << std::setprecision( 2 ) << std::setw( 14 ) << a * per_line << std::setw( 14 ) << b * per_line << "\n";
+	}
+
+	os << std::setw( 10 ) << "total" << std::setw( 14 ) << total( allocations ) << std::setw( 16 ) << total( requested )
+		<< std::setw( 14 ) << total( allocations ) * per_line << std::setw( 14 ) << total( requested ) * per_line << "\n";
+
+	os << "max per line: " << max_line_allocations << " allocations, " << max_line_bytes << " bytes\n";
+	os << "peak heap in use: " << peak.load( std::memory_order_relaxed ) << " bytes\n";
+	os << "peak RSS: " << usage.ru_maxrss << " KiB\n";
+	os << "high-water marks: " << max_tokens.load( std::memory_order_relaxed ) << " tokens, "
+		<< max_stack.load( std::memory_order_relaxed ) << " stack entries\n";
+}
+
+#endif
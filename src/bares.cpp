@@ -12,112 +12,1108 @@
 #include <iostream>
 #include <iomanip>
 #include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "parser.hpp"
 #include "evaluator.hpp"
+#include "program.hpp"
+#include "catalog.hpp"
+#include "thread_pool.hpp"
+#include "parallel_evaluator.hpp"
+#include "parallel_parser.hpp"
+#include "output_writer.hpp"
+#include "shape_batch.hpp"
+#include "template_expander.hpp"
+#include "file_batch.hpp"
+#include "result_cache.hpp"
+#include "expression_dag.hpp"
+#include "traffic_log.hpp"
+#include "engine.hpp"
+#include "aggregate.hpp"
+#include "binary_output.hpp"
+#include "checkpoint.hpp"
+#include "file_follower.hpp"
+#include "compression.hpp"
+#include "alloc_stats.hpp"
+#include "shard_manifest.hpp"
 
 /**
- * @brief      Imprime a devida mensagem de erro a partir do código informado
+ * @brief      Lê as expressões da entrada padrão ( comprimida ou não ) até o
+ *             fim ou até "q"/"p"
  *
- * @param[in]  result  O resultado da avaliação do Parser
- * @param[in]  str     A string com a expressão onde o erro foi encontrado
+ * @return     Vector com as expressões, uma por linha
  */
-void print_parser_error( const Parser::ParserResult & result )
+std::vector< std::string > read_expressions( void )
 {
-	switch ( result.type )
+	std::vector<std::string> expressions;
+	std::string aux;
+	LineSource input;
+
+	while ( input.next( aux ) and aux != "q" and aux != "p")
 	{
-		case Parser::ParserResult::UNEXPECTED_END_OF_EXPRESSION:
-			std::cout << "Unexpected end of input at column (" << result.at_col+1 << ")!\n";
-			break;
-		case Parser::ParserResult::ILL_FORMED_INTEGER:
-			std::cout << "Ill formed integer at column (" << result.at_col+1 << ")!\n";
-			break;
-		case Parser::ParserResult::MISSING_TERM:
-			std::cout << "Missing <term> at column (" << result.at_col+1 << ")!\n";
-			break;
-		case Parser::ParserResult::EXTRANEOUS_SYMBOL:
-			std::cout << "Extraneous symbol after valid expression found at column (" << result.at_col+1 << ")!\n";
-			break;
-		case Parser::ParserResult::INTEGER_OUT_OF_RANGE:
-			std::cout << "Integer constant out of range beginning at column (" << result.at_col+1 << ")!\n";
-			break;
-		case Parser::ParserResult::MISSING_CLOSING_PARENTHESIS:
-			std::cout << "Missing closing \")\" at column (" << result.at_col+1 << ")!\n";
-			break;
-		default:
-			std::cout << ">>> Unhandled error found!\n";
-			break;
+		expressions.push_back( aux );
 	}
+
+	if ( not input.error().empty() )
+	{
+		std::cerr << "bares: " << input.error() << "\n";
+	}
+
+	return expressions;
 }
 
 /**
- * @brief      Imprime a devida mensagem de erro a partir do código informado
+ * @brief      Compila as expressões da entrada padrão em um catálogo
  *
- * @param[in]  result  O resultado da avaliação do Evaluator
+ * @param[in]  path  Caminho do catálogo a ser gravado
+ *
+ * @return     0 se o catálogo foi gravado, 1 caso contrário
  */
-void print_evaluator_error( const Evaluator::EvaluatorResult & result )
+int compile_catalog( const std::string & path )
 {
-	switch ( result.type )
+	Parser my_parser;
+	Evaluator my_evaluator;
+	CatalogWriter writer;
+
+	for( const auto & expr : read_expressions() )
 	{
-		case Evaluator::EvaluatorResult::NUMERIC_OVERFLOW:
-			std::cout << "Numeric overflow error!\n";
-			break;
-		case Evaluator::EvaluatorResult::DIVISION_BY_ZERO:
-			std::cout << "Division by zero!\n";
-			break;
-		default:
-			std::cout << "Unhandled error found!\n";
+		auto result = my_parser.parse( expr );
+
+		if ( result.type != Parser::ParserResult::PARSER_OK )
+		{
+			writer.add( result );
+		}
+		else
+		{
+			writer.add( Program( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) ) );
+		}
+	}
+
+	if ( not writer.save( path ) )
+	{
+		std::cerr << "bares: cannot write catalog " << path << "\n";
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief      Avalia todas as expressões de um catálogo, sem Parser
+ *
+ * @param[in]  path    Caminho do catálogo
+ * @param[in]  verify  Conferir o checksum e todas as entradas antes de avaliar
+ *
+ * @return     0 se o catálogo foi avaliado, 1 se ele está corrompido ou a
+ *             escrita falhou
+ */
+int run_catalog( const std::string & path, bool verify )
+{
+	Catalog cat;
+	auto error = cat.open( path, verify );
+
+	if ( not error.empty() )
+	{
+		std::cerr << "bares: " << error << "\n";
+		return 1;
+	}
+
+	OutputWriter out;
+
+	for ( std::size_t i = 0; i < cat.size(); ++i )
+	{
+		error = cat.check( i );
+		if ( not error.empty() )
+		{
+			out.flush();
+			std::cerr << "bares: " << error << "\n";
+			return 1;
+		}
+
+		auto result = cat.parse_result( i );
+
+		if ( result.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( result );
+		}
+		else
+		{
+			auto resultado = cat.evaluate( i );
+
+			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+			{
+				out.write_evaluator_error( resultado );
+			}
+			else
+			{
+				out.write_value( resultado.value );
+			}
+		}
+	}
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia as expressões da entrada padrão agrupadas por formato
+ *
+ * @return     0, ou 1 se a escrita falhou
+ */
+int run_shapes( void )
+{
+	ShapeBatch batch;
+	OutputWriter out;
+
+	for ( const auto & line : batch.evaluate( read_expressions() ) )
+	{
+		if ( line.parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( line.parsed );
+		}
+		else if ( line.evaluated.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			out.write_evaluator_error( line.evaluated );
+		}
+		else
+		{
+			out.write_value( line.evaluated.value );
+		}
+	}
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia as expressões da entrada padrão compartilhando as
+ *             subexpressões repetidas entre as linhas
+ *
+ * @return     0, ou 1 se a escrita falhou
+ */
+int run_dag( void )
+{
+	ExpressionDag dag;
+	OutputWriter out;
+
+	for ( const auto & line : dag.evaluate( read_expressions() ) )
+	{
+		if ( line.parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( line.parsed );
+		}
+		else if ( line.evaluated.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			out.write_evaluator_error( line.evaluated );
+		}
+		else
+		{
+			out.write_value( line.evaluated.value );
+		}
+	}
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia vários arquivos, cada um com a sua saída
+ *
+ * @param[in]  list     Arquivo com um par "entrada saida" por linha ( "-"
+ *                      para a entrada padrão )
+ * @param[in]  threads  Threads de avaliação ( 0 para uma por núcleo )
+ *
+ * @return     0 se todos os arquivos foram processados, 1 caso contrário
+ */
+int run_files( const std::string & list, std::size_t threads )
+{
+	std::ifstream file;
+	if ( list != "-" )
+	{
+		file.open( list );
+		if ( not file )
+		{
+			std::cerr << "bares: cannot open " << list << "\n";
+			return 1;
+		}
+	}
+	std::istream & in = list == "-" ? std::cin : file;
+
+	std::vector< FileBatch::Job > jobs;
+	std::string line;
+
+	while ( std::getline( in, line ) )
+	{
+		std::istringstream pair( line );
+		FileBatch::Job job;
+
+		if ( pair >> job.input >> job.output )
+		{
+			jobs.push_back( job );
+		}
+	}
+
+	FileBatch batch( threads );
+
+	return batch.run( jobs ) == 0 ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia as expressões da entrada padrão consultando antes o cache
+ *             persistente; as que faltam são avaliadas e guardadas nele
+ *
+ * @param[in]  path   Caminho do arquivo do cache
+ * @param[in]  limit  Tamanho máximo do arquivo, se ainda não existir
+ *
+ * @return     0, ou 1 se a escrita falhou
+ */
+int run_cached( const std::string & path, std::size_t limit )
+{
+	ResultCache cache;
+	auto error = cache.open( path, limit );
+	if ( not error.empty() )
+	{
+		// Sem o cache, a saída é a mesma, apenas sem o atalho
+		std::cerr << "bares: " << error << "\n";
+	}
+
+	Parser my_parser;
+	Evaluator my_evaluator;
+	OutputWriter out;
+
+	for ( const auto & expr : read_expressions() )
+	{
+		ResultCache::Result result;
+
+		if ( not cache.lookup( expr, result ) )
+		{
+			result.parsed = my_parser.parse( expr );
+			if ( result.parsed.type == Parser::ParserResult::PARSER_OK )
+			{
+				result.evaluated = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+			}
+			cache.insert( expr, result );
+		}
+
+		if ( result.parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( result.parsed );
+		}
+		else if ( result.evaluated.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			out.write_evaluator_error( result.evaluated );
+		}
+		else
+		{
+			out.write_value( result.evaluated.value );
+		}
+	}
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia as expressões da entrada padrão gravando cada linha, com
+ *             o instante de chegada, em um registro de tráfego
+ *
+ * @param[in]  path  Caminho do registro
+ *
+ * @return     0, ou 1 se o registro ou a saída não puderam ser gravados
+ */
+int run_recorded( const std::string & path )
+{
+	int fd = ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	if ( fd < 0 )
+	{
+		std::cerr << "bares: cannot create " << path << "\n";
+		return 1;
+	}
+
+	Parser my_parser;
+	Evaluator my_evaluator;
+	OutputWriter out;
+	LineSource input;
+	std::string expr;
+	bool recorded = true;
+
+	{
+		TrafficRecorder recorder( fd );
+
+		// Cada linha é gravada assim que chega, antes da avaliação
+		while ( input.next( expr ) and expr != "q" and expr != "p" )
+		{
+			recorder.record( expr );
+
+			auto result = my_parser.parse( expr );
+
+			if ( result.type != Parser::ParserResult::PARSER_OK )
+			{
+				out.write_parser_error( result );
+				continue;
+			}
+
+			auto resultado = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+
+			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+			{
+				out.write_evaluator_error( resultado );
+			}
+			else
+			{
+				out.write_value( resultado.value );
+			}
+		}
+
+		if ( not recorder.flush() )
+		{
+			std::cerr << "bares: cannot write " << path << "\n";
+			recorded = false;
+		}
+	}
+
+	::close( fd );
+	return out.flush() and recorded ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia um arquivo gravando o progresso periodicamente, e
+ *             continua do último progresso gravado se for interrompido
+ *
+ * @param[in]  ckpt_path  Caminho do arquivo de progresso
+ * @param[in]  input      Arquivo de entrada
+ * @param[in]  output     Arquivo de saída ( igual ao de "bares < entrada" )
+ * @param[in]  interval   Linhas entre duas gravações do progresso
+ *
+ * @return     0 se terminou, 1 caso contrário
+ */
+int run_checkpointed( const std::string & ckpt_path, const std::string & input, const std::string & output, std::size_t interval )
+{
+	Checkpoint ckpt( ckpt_path );
+	checkpoint::State state;
+
+	auto error = ckpt.load( state );
+	if ( not error.empty() )
+	{
+		std::cerr << "bares: " << error << "\n";
+		return 1;
+	}
+
+	// Os dois arquivos são fechados em qualquer saída da função, depois do
+	// OutputWriter ( declarado abaixo ) entregar o que tiver
+	struct Files
+	{
+		int in;
+		int out;
+
+		~Files()
+		{
+			if ( in >= 0 )
+			{
+				::close( in );
+			}
+			if ( out >= 0 )
+			{
+				::close( out );
+			}
+		}
+	} files{ ::open( input.c_str(), O_RDONLY | O_CLOEXEC ), ::open( output.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644 ) };
+
+	int in = files.in;
+	int out = files.out;
+	struct stat in_st, out_st;
+
+	if ( in < 0 or out < 0 or fstat( in, &in_st ) != 0 or fstat( out, &out_st ) != 0 )
+	{
+		std::cerr << "bares: cannot open " << ( in < 0 ? input : output ) << "\n";
+		return 1;
+	}
+
+	auto mtime = static_cast< std::int64_t >( in_st.st_mtim.tv_sec ) * 1000000000 + in_st.st_mtim.tv_nsec;
+
+	// Outra entrada, ou saída menor que a gravada: começa do início
+	if ( state.input_size != static_cast< std::uint64_t >( in_st.st_size ) or state.input_mtime != mtime
+		or state.output_offset > static_cast< std::uint64_t >( out_st.st_size ) )
+	{
+		if ( state.lines > 0 )
+		{
+			std::cerr << "bares: " << ckpt_path << " does not match " << input << " and " << output << ", starting over\n";
+		}
+		state = checkpoint::State();
+		state.input_size = in_st.st_size;
+		state.input_mtime = mtime;
+	}
+
+	// O que foi escrito depois do último progresso gravado é descartado
+	if ( ftruncate( out, state.output_offset ) != 0
+		or lseek( out, state.output_offset, SEEK_SET ) < 0
+		or lseek( in, state.input_offset, SEEK_SET ) < 0 )
+	{
+		std::cerr << "bares: cannot resume " << output << "\n";
+		return 1;
+	}
+
+	const Engine engine{};
+	OutputWriter writer( out );
+
+	std::vector< char > block( 1 << 20 );
+	std::string expr;
+	auto offset = state.input_offset; // Início da próxima linha
+	std::size_t since = 0;            // Linhas desde o último progresso gravado
+	bool finished = false;
+
+	auto evaluate = [&]()
+	{
+		if ( expr == "q" or expr == "p" )
+		{
+			finished = true;
+			return;
+		}
+
+		auto result = engine.evaluate( expr );
+
+		if ( result.parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			writer.write_parser_error( result.parsed );
+		}
+		else if ( result.evaluated.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			writer.write_evaluator_error( result.evaluated );
+		}
+		else
+		{
+			writer.write_value( result.evaluated.value );
+		}
+
+		++state.lines;
+		++since;
+	};
+
+	// Um fsync da saída e um do progresso a cada interval linhas
+	auto save = [&]() -> bool
+	{
+		auto position = writer.flush() ? lseek( out, 0, SEEK_CUR ) : -1;
+		if ( position < 0 or fdatasync( out ) != 0 )
+		{
+			std::cerr << "bares: cannot write " << output << "\n";
+			return false;
+		}
+
+		state.input_offset = offset;
+		state.output_offset = position;
+		since = 0;
+
+		auto err = ckpt.save( state );
+		if ( not err.empty() )
+		{
+			std::cerr << "bares: " << err << "\n";
+			return false;
+		}
+		return true;
+	};
+
+	ssize_t n;
+	while ( not finished and ( n = ::read( in, block.data(), block.size() ) ) != 0 )
+	{
+		if ( n < 0 )
+		{
+			if ( errno == EINTR )
+			{
+				continue;
+			}
+			std::cerr << "bares: cannot read " << input << "\n";
+			return 1;
+		}
+
+		const char * begin = block.data();
+		const char * end = begin + n;
+
+		while ( not finished and begin < end )
+		{
+			auto nl = static_cast< const char * >( std::memchr( begin, '\n', end - begin ) );
+			if ( nl == nullptr )
+			{
+				expr.append( begin, end );
+				break;
+			}
+
+			expr.append( begin, nl );
+			offset += expr.size() + 1;
+			evaluate();
+			expr.clear();
+			begin = nl + 1;
+
+			if ( since >= interval and not save() )
+			{
+				return 1;
+			}
+		}
+	}
+
+	// Última linha sem '\n'
+	if ( not finished and not expr.empty() )
+	{
+		offset += expr.size();
+		evaluate();
+	}
+
+	if ( not writer.flush() or fsync( out ) != 0 )
+	{
+		std::cerr << "bares: cannot write " << output << "\n";
+		return 1;
+	}
+
+	ckpt.remove();
+
+	return 0;
+}
+
+/**
+ * @brief      Avalia as expressões da entrada padrão gravando os resultados
+ *             como registros binários na saída padrão
+ *
+ * @return     0, ou 1 se a entrada ou a saída falharam
+ */
+int run_binary( void )
+{
+	Parser my_parser;
+	Evaluator my_evaluator;
+	BinaryWriter out;
+	LineSource input;
+	std::string expr;
+
+	while ( input.next( expr ) and expr != "q" and expr != "p" )
+	{
+		auto result = my_parser.parse( expr );
+
+		if ( result.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( result );
+			continue;
+		}
+
+		auto resultado = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+
+		if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			out.write_evaluator_error( resultado );
+		}
+		else
+		{
+			out.write_value( resultado.value );
+		}
+	}
+
+	if ( not input.error().empty() )
+	{
+		std::cerr << "bares: " << input.error() << "\n";
+		return 1;
+	}
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Substitui as expressões "${...}" de um documento lido da entrada
+ *             padrão, escrevendo o resultado na saída padrão e os erros na
+ *             saída de erro
+ *
+ * @return     0, ou 1 se algum trecho teve erro ou a leitura ou a escrita
+ *             falharam
+ */
+int run_template( void )
+{
+	OutputWriter out( 1, TemplateExpander::size_type( 1 ) << 20 );
+	OutputWriter errors( 2 );
+	TemplateExpander expander( out, errors );
+	std::vector< char > block( 1 << 20 );
+
+	while ( true )
+	{
+		auto n = ::read( 0, block.data(), block.size() );
+		if ( n < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( n < 0 )
+		{
+			std::cerr << "bares: read error: " << std::strerror( errno ) << "\n";
+			return 1;
+		}
+		if ( n == 0 )
+		{
 			break;
+		}
+		expander.feed( block.data(), n );
 	}
+
+	expander.finish();
+
+	// A saída é enviada mesmo se algum trecho teve erro, e antes das
+	// mensagens, para que uma falha na escrita também seja informada
+	bool written = out.flush();
+	errors.flush();
+
+	return written and expander.error_count() == 0 ? 0 : 1;
 }
 
 /**
- * @brief      Função Principal
+ * @brief      Acompanha um arquivo que cresce, avaliando as linhas novas assim
+ *             que são acrescentadas
+ *
+ * @param[in]  path        Caminho do arquivo
+ * @param[in]  from_start  Avaliar também o conteúdo atual
+ *
+ * @return     0 ao encontrar "q"/"p", ou 1 em erro
+ */
+int run_follow( const std::string & path, bool from_start )
+{
+	FileFollower follower( path );
+	auto error = follower.start( from_start );
+	if ( not error.empty() )
+	{
+		std::cerr << "bares: " << error << "\n";
+		return 1;
+	}
+
+	Parser my_parser;
+	Evaluator my_evaluator;
+	OutputWriter out;
+	std::vector< std::string > lines;
+
+	while ( true )
+	{
+		error = follower.wait( lines );
+		if ( not error.empty() )
+		{
+			std::cerr << "bares: " << error << "\n";
+			return 1;
+		}
+
+		for ( const auto & expr : lines )
+		{
+			if ( expr == "q" or expr == "p" )
+			{
+				return out.flush() ? 0 : 1;
+			}
+
+			auto result = my_parser.parse( expr );
+
+			if ( result.type != Parser::ParserResult::PARSER_OK )
+			{
+				out.write_parser_error( result );
+				continue;
+			}
+
+			auto resultado = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+
+			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+			{
+				out.write_evaluator_error( resultado );
+			}
+			else
+			{
+				out.write_value( resultado.value );
+			}
+		}
+
+		// Os resultados de cada acréscimo saem antes de voltar a esperar
+		if ( not out.flush() )
+		{
+			return 1;
+		}
+	}
+}
+
+/**
+ * @brief      Reduz os resultados da entrada padrão sem escrever cada linha
+ *
+ * @param[in]  reducers  Redutores exibidos ( Aggregate::reducer_t )
+ * @param[in]  threads   Threads do pool; 0 usa o número de núcleos
+ *
+ * @return     0, ou 1 se a leitura ou a escrita falharam
+ */
+int run_aggregate( unsigned reducers, std::size_t threads )
+{
+	constexpr std::size_t CHUNK = 1 << 14;
+
+	ThreadPool pool( threads );
+	const Engine engine{};
+	LineSource input;
+	Aggregate total;
+
+	// Um bloco de linhas e um parcial por thread; os parciais são
+	// combinados depois de cada rodada
+	std::vector< std::vector< std::string > > chunks( pool.size() );
+	std::vector< Aggregate > partials( pool.size() );
+	ThreadPool::Group batch;
+	std::string expr;
+	bool more = true;
+
+	while ( more )
+	{
+		std::size_t used = 0;
+		for ( ; used < chunks.size() and more; ++used )
+		{
+			auto & chunk = chunks[ used ];
+			chunk.clear();
+			while ( chunk.size() < CHUNK and ( more = input.next( expr ) and expr != "q" and expr != "p" ) )
+			{
+				chunk.push_back( expr );
+			}
+		}
+
+		for ( std::size_t i = 0; i < used; ++i )
+		{
+			partials[ i ] = Aggregate();
+			pool.submit( batch, [&engine, &chunks, &partials, i]()
+			{
+				auto & ctx = Engine::local_context();
+				for ( const auto & line : chunks[ i ] )
+				{
+					partials[ i ].add( engine.evaluate( line, ctx ) );
+				}
+			} );
+		}
+		pool.wait( batch );
+
+		for ( std::size_t i = 0; i < used; ++i )
+		{
+			total.merge( partials[ i ] );
+		}
+	}
+
+	if ( not input.error().empty() )
+	{
+		std::cerr << "bares: " << input.error() << "\n";
+		return 1;
+	}
+
+	// O relatório sai pelo OutputWriter, como nos demais modos, então também
+	// passa pela compressão de "--compress"
+	std::ostringstream report;
+	total.write( report, reducers );
+
+	OutputWriter out;
+	auto text = report.str();
+	out.write( text.data(), text.size() );
+
+	return out.flush() ? 0 : 1;
+}
+
+/**
+ * @brief      Avalia uma parte de uma entrada dividida pelo shard_split
+ *
+ * @details    Lê o arquivo da parte, grava os resultados em "<parte>.out" e,
+ *             se a parte conferir com o manifesto ( linhas, bytes e checksum ),
+ *             grava "<parte>.done" com as linhas, os bytes e o checksum da
+ *             saída, que o shard_merge confere antes de juntar.
+ *
+ * @param[in]  manifest_path  Caminho do manifesto
+ * @param[in]  index          Índice da parte
+ *
+ * @return     0, ou 1 se a parte não confere ou a leitura ou escrita falharam
+ */
+int run_shard( const std::string & manifest_path, std::size_t index )
+{
+	sharding::Manifest manifest;
+	auto error = sharding::read_manifest( manifest_path, manifest );
+	if ( not error.empty() or index >= manifest.shards.size() )
+	{
+		std::cerr << "bares: " << ( error.empty() ? "no shard " + std::to_string( index ) + " in " + manifest_path : error ) << "\n";
+		return 1;
+	}
+
+	const auto & shard = manifest.shards[ index ];
+	auto base = sharding::resolve( manifest_path, shard.file );
+	auto out_path = base + ".out";
+	auto done_path = base + ".done";
+
+	// Um registro antigo não pode validar uma saída nova
+	::unlink( done_path.c_str() );
+
+	int in_fd = ::open( base.c_str(), O_RDONLY );
+	if ( in_fd < 0 )
+	{
+		std::cerr << "bares: cannot open " << base << ": " << std::strerror( errno ) << "\n";
+		return 1;
+	}
+	int out_fd = ::open( out_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+	if ( out_fd < 0 )
+	{
+		std::cerr << "bares: cannot open " << out_path << ": " << std::strerror( errno ) << "\n";
+		::close( in_fd );
+		return 1;
+	}
+
+	sharding::Checksum checksum;
+	std::uint64_t lines = 0, bytes = 0;
+	bool written;
+	{
+		Parser my_parser;
+		Evaluator my_evaluator;
+		LineSource input( in_fd );
+		OutputWriter out( out_fd, OutputWriter::size_type( 1 ) << 20 );
+		std::string expr;
+
+		while ( input.next( expr ) )
+		{
+			expr.push_back( '\n' );
+			checksum.update( expr.data(), expr.size() );
+			bytes += expr.size();
+			++lines;
+			expr.pop_back();
+
+			auto result = my_parser.parse( expr );
+
+			if ( result.type != Parser::ParserResult::PARSER_OK )
+			{
+				out.write_parser_error( result );
+				continue;
+			}
+
+			auto resultado = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+
+			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+			{
+				out.write_evaluator_error( resultado );
+			}
+			else
+			{
+				out.write_value( resultado.value );
+			}
+		}
+
+		error = input.error();
+		written = out.flush();
+	}
+	::close( in_fd );
+	written = ::close( out_fd ) == 0 and written;
+
+	if ( not error.empty() or not written )
+	{
+		std::cerr << "bares: " << ( error.empty() ? "cannot write " + out_path : error ) << "\n";
+		return 1;
+	}
+	if ( lines != shard.lines or bytes != shard.bytes or checksum.value() != shard.checksum )
+	{
+		std::cerr << "bares: " << base << " does not match " << manifest_path << "\n";
+		return 1;
+	}
+
+	sharding::Done done;
+	error = sharding::scan_file( out_path, done );
+	if ( error.empty() )
+	{
+		error = sharding::write_done( done_path, done );
+	}
+	if ( not error.empty() )
+	{
+		std::cerr << "bares: " << error << "\n";
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief      Executa o modo escolhido pelos argumentos
  *
  * @param[in]  argc  The argc
  * @param      argv  The argv
  *
- * @return     0
+ * @return     0, ou 1 se o modo escolhido falhou ( inclusive na escrita )
  */
-int main(int argc, char const *argv[])
+int run( int argc, char const *argv[] )
 {
+	if ( argc >= 3 and std::string( argv[1] ) == "--compile" )
+	{
+		return compile_catalog( argv[2] );
+	}
+	if ( argc >= 3 and std::string( argv[1] ) == "--load" )
+	{
+		return run_catalog( argv[2], argc >= 4 and std::string( argv[3] ) == "--verify" );
+	}
+	if ( argc >= 3 and std::string( argv[1] ) == "--files" )
+	{
+		return run_files( argv[2], argc >= 4 ? std::strtoul( argv[3], nullptr, 10 ) : 0 );
+	}
+	if ( argc >= 5 and std::string( argv[1] ) == "--checkpoint" )
+	{
+		std::size_t interval = argc >= 6 ? std::strtoul( argv[5], nullptr, 10 ) : 0;
+		return run_checkpointed( argv[2], argv[3], argv[4], interval == 0 ? 100000 : interval );
+	}
+	if ( argc >= 3 and std::string( argv[1] ) == "--follow" )
+	{
+		return run_follow( argv[2], argc >= 4 and std::string( argv[3] ) == "--from-start" );
+	}
+	if ( argc >= 4 and std::string( argv[1] ) == "--shard" )
+	{
+		return run_shard( argv[2], std::strtoul( argv[3], nullptr, 10 ) );
+	}
+	if ( argc >= 3 and std::string( argv[1] ) == "--record" )
+	{
+		return run_recorded( argv[2] );
+	}
+	if ( argc >= 3 and std::string( argv[1] ) == "--cache" )
+	{
+		return run_cached( argv[2], argc >= 4 ? std::strtoul( argv[3], nullptr, 10 ) << 20 : ResultCache::DEFAULT_LIMIT );
+	}
+	if ( argc >= 2 and std::string( argv[1] ) == "--shapes" )
+	{
+		return run_shapes();
+	}
+	if ( argc >= 2 and std::string( argv[1] ) == "--dag" )
+	{
+		return run_dag();
+	}
+	if ( argc >= 2 and std::string( argv[1] ) == "--aggregate" )
+	{
+		unsigned reducers = Aggregate::ALL;
+		if ( argc >= 3 and not Aggregate::parse_reducers( argv[2], reducers ) )
+		{
+			std::cerr << "bares: unknown reducer in " << argv[2] << " ( use sum, min, max, count, histogram or all )\n";
+			return 1;
+		}
+		return run_aggregate( reducers, argc >= 4 ? std::strtoul( argv[3], nullptr, 10 ) : 0 );
+	}
+	if ( argc >= 2 and std::string( argv[1] ) == "--binary" )
+	{
+		return run_binary();
+	}
+	if ( argc >= 2 and std::string( argv[1] ) == "--template" )
+	{
+		return run_template();
+	}
 
-	std::vector<std::string> expressions;
-	std::string aux;
-
-	while ( std::getline(std::cin, aux) and aux != "q" and aux != "p")
+	// Modo paralelo: cada expressão é tokenizada e avaliada pelas threads do pool
+	std::unique_ptr< ThreadPool > pool;
+	std::unique_ptr< ParallelParser > parallel_parser;
+	if ( argc >= 2 and std::string( argv[1] ) == "--parallel" )
 	{
-		expressions.push_back( aux );
+		pool.reset( new ThreadPool( argc >= 3 ? std::strtoul( argv[2], nullptr, 10 ) : 0 ) );
+		parallel_parser.reset( new ParallelParser( *pool ) );
 	}
 
+	// As linhas são avaliadas à medida que a thread de leitura as entrega
+	LineSource input;
+	std::string expr;
+
 	Parser my_parser;
 	Evaluator my_evaluator;
+	OutputWriter out;
 
-	for( const auto & expr : expressions )
+	while ( input.next( expr ) and expr != "q" and expr != "p" )
 	{
-		auto result = my_parser.parse( expr );
+		BARES_ALLOC_STAGE( PARSE );
+		auto result = parallel_parser ? parallel_parser->parse( expr ) : my_parser.parse( expr );
 
 		if ( result.type != Parser::ParserResult::PARSER_OK )
 		{
-			print_parser_error( result );
+			BARES_ALLOC_STAGE( OUTPUT );
+			out.write_parser_error( result );
 		}
 		else
 		{
-			auto lista = my_parser.get_tokens();
+			auto lista = parallel_parser ? parallel_parser->get_tokens() : my_parser.get_tokens();
 
+			BARES_ALLOC_STAGE( POSTFIX );
 			auto postfix = my_evaluator.infix_to_postfix( lista );
-			auto resultado = my_evaluator.evaluate_postfix( postfix );
 
+			BARES_ALLOC_STAGE( EVALUATE );
+			auto resultado = pool ? ParallelEvaluator( *pool ).evaluate_postfix( postfix )
+			                      : my_evaluator.evaluate_postfix( postfix );
+
+			BARES_ALLOC_STAGE( OUTPUT );
 			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
 			{
-				print_evaluator_error( resultado );
+				out.write_evaluator_error( resultado );
 			}
 			else
 			{
-				std::cout << resultado.value << std::endl;
+				out.write_value( resultado.value );
 			}
 		}
+
+		BARES_ALLOC_LINE();
+		BARES_ALLOC_STAGE( INPUT );
 	}
 
-	return 0;
-}
\ No newline at end of file
+	BARES_ALLOC_STAGE( OTHER );
+
+	bool written = out.flush();
+
+	if ( not input.error().empty() )
+	{
+		std::cerr << "bares: " << input.error() << "\n";
+		return 1;
+	}
+
+	return written ? 0 : 1;
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0, ou 1 em erro
+ */
+int main(int argc, char const *argv[])
+{
+	compression::format_t format;
+
+	if ( argc < 3 or std::string( argv[1] ) != "--compress" )
+	{
+		int code = run( argc, argv );
+		BARES_ALLOC_REPORT( std::cerr );
+		return code;
+	}
+
+	if ( not compression::from_name( argv[2], format ) or not compression::is_supported( format ) )
+	{
+		std::cerr << "bares: output compression " << argv[2] << " is not available\n";
+		return 1;
+	}
+
+	// Tudo o que o modo escolhido escreve na saída padrão passa por um pipe
+	// até a thread de compressão, que grava na saída padrão original
+	int target = dup( 1 );
+	int fds[2];
+	if ( target < 0 or pipe( fds ) != 0 or dup2( fds[1], 1 ) < 0 )
+	{
+		std::cerr << "bares: cannot set up output compression\n";
+		return 1;
+	}
+	::close( fds[1] );
+
+	std::vector< char const * > args( argv + 2, argv + argc );
+	args[0] = argv[0];
+
+	StreamCompressor compressor( fds[0], target, format );
+
+	int code = run( static_cast< int >( args.size() ), args.data() );
+	BARES_ALLOC_REPORT( std::cerr );
+
+	// Fechar a ponta de escrita encerra a entrada do compressor; o que ainda
+	// estiver no buffer do std::cout precisa sair antes
+	std::cout.flush();
+	::close( 1 );
+	auto error = compressor.finish();
+	::close( fds[0] );
+	::close( target );
+
+	if ( not error.empty() )
+	{
+		std::cerr << "bares: " << error << "\n";
+		return 1;
+	}
+
+	return code;
+}
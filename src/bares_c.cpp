@@ -0,0 +1,202 @@
+/**
+ * @file bares_c.cpp
+ * @brief      Implementação da API C da libbares
+ * @details    Envolve um Engine compartilhado. Cada thread ( inclusive as de
+ *             um lote ) usa o seu próprio Engine::Context, então não há
+ *             estado compartilhado. Nenhuma exceção atravessa a API C: uma
+ *             falha de alocação vira o status BARES_INTERNAL_ERROR.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::min
+#include <thread>   	// std::thread
+#include <vector>   	// std::vector
+
+#include "bares.h"
+#include "engine.hpp"
+
+namespace
+{
+	/**
+	 * @brief      Lotes menores que isso são avaliados na thread de quem chama
+	 */
+	constexpr std::size_t MIN_PARALLEL_BATCH = 4096;
+
+	/**
+	 * @brief      O Engine não tem estado, então um basta para todas as threads
+	 */
+	const Engine engine{};
+
+	/**
+	 * @brief      Avalia uma expressão com o contexto informado
+	 *
+	 * @param      ctx   Contexto da thread atual
+	 * @param[in]  expr  Expressão
+	 * @param[out] out   Onde gravar o resultado
+	 */
+	void evaluate( Engine::Context & ctx, const char * expr, bares_result * out )
+	{
+		out->value = 0;
+		out->code = 0;
+		out->column = 0;
+
+		if ( expr == nullptr )
+		{
+			out->status = BARES_INVALID_ARGUMENT;
+			return;
+		}
+
+		Engine::Result result;
+		try
+		{
+			result = engine.evaluate( expr, ctx );
+		}
+		catch ( ... )
+		{
+			out->status = BARES_INTERNAL_ERROR;
+			return;
+		}
+
+		const auto & parsed = result.parsed;
+		const auto & evaluated = result.evaluated;
+
+		if ( parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			out->status = BARES_PARSER_ERROR;
+			out->code = parsed.type;
+			out->column = parsed.at_col + 1;
+			return;
+		}
+
+		if ( evaluated.type != Evaluator::EvaluatorResult::RESULT_OK )
+		{
+			out->status = BARES_EVALUATOR_ERROR;
+			out->code = evaluated.type;
+			return;
+		}
+
+		out->status = BARES_OK;
+		out->value = evaluated.value;
+	}
+
+	/**
+	 * @brief      Avalia o intervalo [first, last) do lote
+	 *
+	 * @return     Quantidade de expressões com status BARES_OK
+	 */
+	std::size_t evaluate_range( const char * const * exprs, bares_result * results, std::size_t first, std::size_t last )
+	{
+		Engine::Context * ctx = nullptr;
+		std::size_t ok = 0;
+
+		try
+		{
+			ctx = &Engine::local_context();
+		}
+		catch ( ... )
+		{
+			for ( auto i = first; i < last; ++i )
+			{
+				results[ i ] = bares_result{ 0, BARES_INTERNAL_ERROR, 0, 0 };
+			}
+			return 0;
+		}
+
+		for ( auto i = first; i < last; ++i )
+		{
+			evaluate( *ctx, exprs[ i ], &results[ i ] );
+			ok += results[ i ].status == BARES_OK;
+		}
+
+		return ok;
+	}
+}
+
+int bares_api_version( void )
+{
+	return BARES_API_VERSION;
+}
+
+int bares_eval( const char * expr, bares_result * result )
+{
+	if ( result == nullptr )
+	{
+		return BARES_INVALID_ARGUMENT;
+	}
+
+	try
+	{
+		evaluate( Engine::local_context(), expr, result );
+	}
+	catch ( ... )
+	{
+		*result = bares_result{ 0, BARES_INTERNAL_ERROR, 0, 0 };
+	}
+
+	return result->status;
+}
+
+size_t bares_eval_batch( const char * const * exprs, size_t n, bares_result * results )
+{
+	if ( exprs == nullptr or results == nullptr )
+	{
+		return 0;
+	}
+
+	std::size_t workers = std::max( 1u, std::thread::hardware_concurrency() );
+	workers = std::min( workers, n / MIN_PARALLEL_BATCH );
+
+	if ( workers <= 1 )
+	{
+		return evaluate_range( exprs, results, 0, n );
+	}
+
+	// Cada thread fica com um bloco contíguo, então escreve em uma região
+	// própria do vetor de resultados
+	std::vector< std::thread > pool;
+	std::vector< std::size_t > ok;
+	try
+	{
+		// Reservado antes: emplace_back não realoca com threads já criadas
+		pool.reserve( workers );
+		ok.assign( workers, 0 );
+	}
+	catch ( ... )
+	{
+		return evaluate_range( exprs, results, 0, n );
+	}
+
+	auto chunk = ( n + workers - 1 ) / workers;
+
+	for ( std::size_t w = 0; w < workers; ++w )
+	{
+		auto first = w * chunk;
+		auto last = std::min( n, first + chunk );
+
+		try
+		{
+			pool.emplace_back( [=, &ok]() { ok[ w ] = evaluate_range( exprs, results, first, last ); } );
+		}
+		catch ( ... )
+		{
+			// Sem threads ( ou memória ) disponíveis: o bloco é avaliado aqui mesmo
+			ok[ w ] = evaluate_range( exprs, results, first, last );
+		}
+	}
+
+	for ( auto & t : pool )
+	{
+		t.join();
+	}
+
+	std::size_t total = 0;
+	for ( auto count : ok )
+	{
+		total += count;
+	}
+
+	return total;
+}
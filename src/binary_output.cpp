@@ -0,0 +1,121 @@
+/**
+ * @file binary_output.cpp
+ * @brief      Implementação dos métodos da classe BinaryWriter
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstring>  	// std::memcmp, std::memcpy
+
+#include "binary_output.hpp"
+
+static_assert( sizeof( binary_output::Header ) == 24, "Header deve ter 24 bytes" );
+static_assert( sizeof( binary_output::Record ) == 24, "Record deve ter 24 bytes" );
+static_assert( sizeof( Evaluator::value_type ) <= sizeof( std::int64_t ), "o valor deve caber no registro" );
+
+constexpr BinaryWriter::size_type BinaryWriter::BLOCK;
+
+/**
+ * @brief      Confere se um cabeçalho é compatível
+ *
+ * @param[in]  header  O cabeçalho
+ *
+ * @return     Vazio se é compatível, ou a descrição do problema
+ */
+std::string binary_output::check( const Header & header )
+{
+	if ( std::memcmp( header.magic, MAGIC, sizeof( header.magic ) ) != 0 )
+	{
+		return "not a bares binary output";
+	}
+	if ( header.byte_order != ENDIAN_MARK )
+	{
+		return "binary output written with a different byte order";
+	}
+	if ( header.version != VERSION or header.record_size != sizeof( Record ) or header.value_width != sizeof( std::int64_t ) )
+	{
+		return "unsupported binary output version";
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Construtor do BinaryWriter, grava o cabeçalho
+ *
+ * @param[in]  fd    Descritor da saída
+ */
+BinaryWriter::BinaryWriter( int fd )
+	: out( fd, BLOCK )
+{
+	binary_output::Header header{};
+	std::memcpy( header.magic, binary_output::MAGIC, sizeof( header.magic ) );
+	header.version = binary_output::VERSION;
+	header.record_size = sizeof( binary_output::Record );
+	header.value_width = sizeof( std::int64_t );
+	header.byte_order = binary_output::ENDIAN_MARK;
+
+	out.write( reinterpret_cast< const char * >( &header ), sizeof( header ) );
+}
+
+/**
+ * @brief      Grava um registro e avança a linha
+ *
+ * @param[in]  stage   A etapa
+ * @param[in]  code    O código do resultado
+ * @param[in]  column  A coluna do erro
+ * @param[in]  value   O valor
+ */
+void BinaryWriter::write_record( std::uint8_t stage, std::uint8_t code, std::uint32_t column, std::int64_t value )
+{
+	binary_output::Record r{};
+	r.line = line++;
+	r.column = column;
+	r.stage = stage;
+	r.code = code;
+	r.value = value;
+
+	out.write( reinterpret_cast< const char * >( &r ), sizeof( r ) );
+}
+
+/**
+ * @brief      Grava o valor de uma expressão
+ *
+ * @param[in]  value  O valor
+ */
+void BinaryWriter::write_value( long long value )
+{
+	write_record( binary_output::OK, 0, 0, value );
+}
+
+/**
+ * @brief      Grava o erro do Parser
+ *
+ * @param[in]  result  O resultado da avaliação do Parser
+ */
+void BinaryWriter::write_parser_error( const Parser::ParserResult & result )
+{
+	write_record( binary_output::PARSER, static_cast< std::uint8_t >( result.type ), static_cast< std::uint32_t >( result.at_col ), 0 );
+}
+
+/**
+ * @brief      Grava o erro do Evaluator
+ *
+ * @param[in]  result  O resultado da avaliação do Evaluator
+ */
+void BinaryWriter::write_evaluator_error( const Evaluator::EvaluatorResult & result )
+{
+	write_record( binary_output::EVALUATOR, static_cast< std::uint8_t >( result.type ), 0, 0 );
+}
+
+/**
+ * @brief      Descarrega o bloco atual
+ *
+ * @return     True se todas as escritas até agora deram certo
+ */
+bool BinaryWriter::flush( void )
+{
+	return out.flush();
+}
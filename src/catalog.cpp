@@ -0,0 +1,430 @@
+/**
+ * @file catalog.cpp
+ * @brief      Implementação das classes CatalogWriter e Catalog
+ * @details    Grava e mapeia catálogos de expressões compiladas.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstdio>   	// std::rename, std::remove
+#include <cstring>  	// std::memcmp, std::memcpy, std::memset
+#include <fstream>  	// std::ofstream
+#include <stdexcept>	// std::runtime_error
+
+#include <fcntl.h>  	// open
+#include <sys/mman.h>	// mmap, munmap
+#include <sys/stat.h>	// fstat
+#include <unistd.h> 	// close
+
+#include "catalog.hpp"
+#include "range_analysis.hpp"
+
+static_assert( sizeof( catalog::Header ) == 48, "Header deve ter 48 bytes" );
+static_assert( sizeof( catalog::Entry ) == 40, "Entry deve ter 40 bytes" );
+static_assert( sizeof( Program::Instruction ) == 8, "Instruction deve ter 8 bytes" );
+
+/**
+ * @brief      Calcula o FNV-1a de 64 bits de um bloco de memória
+ *
+ * @param[in]  data  Início do bloco
+ * @param[in]  size  Tamanho do bloco
+ * @param[in]  hash  Valor inicial
+ *
+ * @return     O hash
+ */
+std::uint64_t catalog::fnv1a( const void * data, std::size_t size, std::uint64_t hash )
+{
+	auto p = static_cast< const unsigned char * >( data );
+
+	for ( std::size_t i = 0; i < size; ++i )
+	{
+		hash ^= p[ i ];
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+/**
+ * @brief      Adiciona uma expressão compilada
+ *
+ * @param[in]  program  A expressão compilada
+ */
+void CatalogWriter::add( const Program & program )
+{
+	catalog::Entry e{};
+	e.first_instruction = code.size();
+	e.first_constant = constants.size();
+	e.instruction_count = static_cast< std::uint32_t >( program.instructions().size() );
+	e.max_depth = static_cast< std::uint32_t >( program.max_depth() );
+	e.parser_code = Parser::ParserResult::PARSER_OK;
+
+	entries.push_back( e );
+	code.insert( code.end(), program.instructions().begin(), program.instructions().end() );
+	constants.insert( constants.end(), program.slots().begin(), program.slots().end() );
+
+	// O catálogo sempre avalia com os literais gravados, então a análise de
+	// faixas pode usar os valores exatos
+	RangeAnalysis::annotate( code.data() + e.first_instruction, e.instruction_count,
+		constants.data() + e.first_constant );
+}
+
+/**
+ * @brief      Adiciona uma expressão que falhou na análise
+ *
+ * @param[in]  parsed  O resultado do Parser
+ */
+void CatalogWriter::add( const Parser::ParserResult & parsed )
+{
+	catalog::Entry e{};
+	e.first_instruction = code.size();
+	e.first_constant = constants.size();
+	e.parser_code = parsed.type;
+	e.at_col = parsed.at_col;
+
+	entries.push_back( e );
+}
+
+/**
+ * @brief      Informa quantas expressões foram adicionadas
+ *
+ * @return     Quantidade de expressões
+ */
+std::size_t CatalogWriter::size( void ) const
+{
+	return entries.size();
+}
+
+/**
+ * @brief      Grava o catálogo em um arquivo temporário e o renomeia
+ *
+ * @param[in]  path  Caminho do arquivo
+ *
+ * @return     True se foi gravado, False caso contrário
+ */
+bool CatalogWriter::save( const std::string & path ) const
+{
+	// Instruction possui bytes de preenchimento; zerá-los deixa o arquivo
+	// ( e o checksum ) determinístico
+	std::vector< Program::Instruction > packed( code.size() );
+	std::memset( static_cast< void * >( packed.data() ), 0, packed.size() * sizeof( Program::Instruction ) );
+	for ( std::size_t i = 0; i < code.size(); ++i )
+	{
+		packed[ i ].op = code[ i ].op;
+		packed[ i ].slot = code[ i ].slot;
+	}
+
+	auto entries_size = entries.size() * sizeof( catalog::Entry );
+	auto code_size = packed.size() * sizeof( Program::Instruction );
+	auto constants_size = constants.size() * sizeof( Program::value_type );
+
+	catalog::Header h{};
+	std::memcpy( h.magic, catalog::MAGIC, sizeof( h.magic ) );
+	h.version = catalog::VERSION;
+	h.value_size = sizeof( Program::value_type );
+	h.byte_order = catalog::ENDIANNESS;
+	h.count = entries.size();
+	h.instruction_count = packed.size();
+	h.constant_count = constants.size();
+	h.checksum = catalog::fnv1a( entries.data(), entries_size );
+	h.checksum = catalog::fnv1a( packed.data(), code_size, h.checksum );
+	h.checksum = catalog::fnv1a( constants.data(), constants_size, h.checksum );
+
+	auto tmp = path + ".tmp";
+	{
+		std::ofstream out( tmp, std::ios::binary | std::ios::trunc );
+
+		out.write( reinterpret_cast< const char * >( &h ), sizeof( h ) );
+		out.write( reinterpret_cast< const char * >( entries.data() ), entries_size );
+		out.write( reinterpret_cast< const char * >( packed.data() ), code_size );
+		out.write( reinterpret_cast< const char * >( constants.data() ), constants_size );
+
+		if ( not out )
+		{
+			std::remove( tmp.c_str() );
+			return false;
+		}
+	}
+
+	return std::rename( tmp.c_str(), path.c_str() ) == 0;
+}
+
+/**
+ * @brief      Destrutor, desfaz o mapeamento
+ */
+Catalog::~Catalog()
+{
+	close();
+}
+
+/**
+ * @brief      Desfaz o mapeamento atual
+ */
+void Catalog::close( void )
+{
+	if ( base != nullptr )
+	{
+		munmap( const_cast< unsigned char * >( base ), length );
+	}
+
+	base = nullptr;
+	length = 0;
+	header = nullptr;
+	entries = nullptr;
+	code = nullptr;
+	constants = nullptr;
+	checked.reset();
+}
+
+/**
+ * @brief      Valida os limites e as instruções de uma entrada
+ *
+ * @param[in]  e     A entrada
+ *
+ * @return     True se a entrada pode ser avaliada com segurança
+ */
+bool Catalog::valid( const catalog::Entry & e ) const
+{
+	if ( e.parser_code < Parser::ParserResult::PARSER_OK or e.parser_code > Parser::ParserResult::INTEGER_OUT_OF_RANGE
+		or e.first_instruction > header->instruction_count
+		or e.instruction_count > header->instruction_count - e.first_instruction
+		or e.first_constant > header->constant_count )
+	{
+		return false;
+	}
+	if ( e.parser_code != Parser::ParserResult::PARSER_OK )
+	{
+		return e.instruction_count == 0;
+	}
+
+	// Simula a pilha: cada PUSH usa um literal da entrada e cada operação
+	// consome dois valores
+	auto slots = header->constant_count - e.first_constant;
+	std::uint64_t depth = 0;
+
+	for ( std::uint64_t i = 0; i < e.instruction_count; ++i )
+	{
+		const auto & ins = code[ e.first_instruction + i ];
+		unsigned op = ins.op & ~Program::Instruction::UNCHECKED;
+
+		if ( ins.op == Program::Instruction::PUSH )
+		{
+			if ( ins.slot >= slots or ++depth > e.max_depth )
+			{
+				return false;
+			}
+		}
+		else if ( op == Program::Instruction::PUSH or op >= Program::Instruction::OPCODE_COUNT or depth < 2 )
+		{
+			return false;
+		}
+		else
+		{
+			--depth;
+		}
+	}
+
+	if ( e.instruction_count != 0 and depth != 1 )
+	{
+		return false;
+	}
+
+	// O bit UNCHECKED vem do arquivo e tira os testes de divisor e de
+	// estouro: refaz a análise com os literais mapeados e recusa a entrada
+	// se alguma operação marcada não for provada segura
+	std::vector< Program::Instruction > proven( code + e.first_instruction, code + e.first_instruction + e.instruction_count );
+	for ( auto & ins : proven )
+	{
+		ins.op = static_cast< Program::Instruction::opcode_t >( ins.op & ~Program::Instruction::UNCHECKED );
+	}
+	RangeAnalysis::annotate( proven.data(), proven.size(), constants + e.first_constant );
+
+	for ( std::uint64_t i = 0; i < e.instruction_count; ++i )
+	{
+		if ( ( code[ e.first_instruction + i ].op & Program::Instruction::UNCHECKED )
+			and not ( proven[ i ].op & Program::Instruction::UNCHECKED ) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief      Mapeia o arquivo e valida o cabeçalho e os tamanhos
+ *
+ * @param[in]  path    Caminho do arquivo
+ * @param[in]  verify  Se o checksum e todas as entradas devem ser conferidos
+ *
+ * @return     Mensagem vazia se deu certo, ou a descrição do problema
+ */
+std::string Catalog::open( const std::string & path, bool verify )
+{
+	close();
+
+	int fd = ::open( path.c_str(), O_RDONLY );
+	if ( fd < 0 )
+	{
+		return "cannot open " + path;
+	}
+
+	struct stat st;
+	if ( fstat( fd, &st ) != 0 or static_cast< std::size_t >( st.st_size ) < sizeof( catalog::Header ) )
+	{
+		::close( fd );
+		return "truncated catalog";
+	}
+
+	length = st.st_size;
+	void * m = mmap( nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+	::close( fd );
+
+	if ( m == MAP_FAILED )
+	{
+		length = 0;
+		return "cannot map " + path;
+	}
+
+	base = static_cast< const unsigned char * >( m );
+	header = reinterpret_cast< const catalog::Header * >( base );
+
+	if ( std::memcmp( header->magic, catalog::MAGIC, sizeof( header->magic ) ) != 0 )
+	{
+		close();
+		return "not a bares catalog";
+	}
+	if ( ( header->version != catalog::VERSION and header->version != 1 )
+		or header->value_size != sizeof( Program::value_type )
+		or header->byte_order != catalog::ENDIANNESS )
+	{
+		close();
+		return "unsupported catalog version or layout";
+	}
+
+	// Cada quantidade é comparada com o espaço que sobra antes de ser
+	// multiplicada, então nenhum tamanho dá a volta
+	auto available = length - sizeof( catalog::Header );
+	if ( header->count > available / sizeof( catalog::Entry ) )
+	{
+		close();
+		return "truncated catalog";
+	}
+	auto entries_size = header->count * sizeof( catalog::Entry );
+	available -= entries_size;
+
+	if ( header->instruction_count > available / sizeof( Program::Instruction ) )
+	{
+		close();
+		return "truncated catalog";
+	}
+	auto code_size = header->instruction_count * sizeof( Program::Instruction );
+	available -= code_size;
+
+	if ( header->constant_count != available / sizeof( Program::value_type )
+		or available % sizeof( Program::value_type ) != 0 )
+	{
+		close();
+		return "truncated catalog";
+	}
+
+	entries = reinterpret_cast< const catalog::Entry * >( base + sizeof( catalog::Header ) );
+	code = reinterpret_cast< const Program::Instruction * >( base + sizeof( catalog::Header ) + entries_size );
+	constants = reinterpret_cast< const Program::value_type * >( base + sizeof( catalog::Header ) + entries_size + code_size );
+	checked.reset( new std::atomic< unsigned char >[ header->count ] );
+	for ( std::size_t i = 0; i < header->count; ++i )
+	{
+		checked[ i ].store( UNCHECKED, std::memory_order_relaxed );
+	}
+
+	if ( not verify )
+	{
+		return "";
+	}
+
+	if ( catalog::fnv1a( base + sizeof( catalog::Header ), length - sizeof( catalog::Header ) ) != header->checksum )
+	{
+		close();
+		return "checksum mismatch";
+	}
+
+	for ( std::size_t i = 0; i < header->count; ++i )
+	{
+		auto error = check( i );
+		if ( not error.empty() )
+		{
+			close();
+			return error;
+		}
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Valida a entrada i, na primeira chamada
+ *
+ * @param[in]  i     Índice da expressão
+ *
+ * @return     Mensagem vazia se a entrada é válida, ou a descrição do problema
+ */
+std::string Catalog::check( std::size_t i ) const
+{
+	auto state = checked[ i ].load( std::memory_order_relaxed );
+
+	if ( state == UNCHECKED )
+	{
+		// Duas threads podem validar a mesma entrada; o resultado é o mesmo
+		state = valid( entries[ i ] ) ? VALID : INVALID;
+		checked[ i ].store( state, std::memory_order_relaxed );
+	}
+
+	return state == VALID ? "" : "corrupted catalog entry " + std::to_string( i );
+}
+
+/**
+ * @brief      Informa quantas expressões o catálogo possui
+ *
+ * @return     Quantidade de expressões
+ */
+std::size_t Catalog::size( void ) const
+{
+	return header == nullptr ? 0 : header->count;
+}
+
+/**
+ * @brief      Recupera o resultado da análise da expressão i
+ *
+ * @param[in]  i     Índice da expressão
+ *
+ * @return     O ParserResult guardado
+ */
+Parser::ParserResult Catalog::parse_result( std::size_t i ) const
+{
+	return Parser::ParserResult( static_cast< Parser::ParserResult::code_t >( entries[ i ].parser_code ), entries[ i ].at_col );
+}
+
+/**
+ * @brief      Avalia a expressão i direto das páginas mapeadas
+ *
+ * @param[in]  i     Índice da expressão ( sem erro de análise )
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ *
+ * @throws     std::runtime_error se a entrada não passa em check()
+ */
+Evaluator::EvaluatorResult Catalog::evaluate( std::size_t i ) const
+{
+	auto error = check( i );
+	if ( not error.empty() )
+	{
+		throw std::runtime_error( error );
+	}
+
+	const auto & e = entries[ i ];
+
+	return Program::execute( code + e.first_instruction, e.instruction_count,
+		constants + e.first_constant, e.max_depth );
+}
@@ -0,0 +1,138 @@
+/**
+ * @file checkpoint.cpp
+ * @brief      Implementação dos métodos da classe Checkpoint
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno
+#include <cstddef>  	// offsetof
+#include <cstring>  	// std::memcmp, std::memcpy, std::strerror
+
+#include <fcntl.h>  	// open
+#include <stdio.h>  	// rename
+#include <unistd.h> 	// read, write, fsync, close, unlink
+
+#include "checkpoint.hpp"
+
+static_assert( sizeof( checkpoint::Record ) == 64, "Record deve ter 64 bytes" );
+
+/**
+ * @brief      Construtor do Checkpoint
+ *
+ * @param[in]  path_  Caminho do arquivo
+ */
+Checkpoint::Checkpoint( const std::string & path_ )
+	: path( path_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Calcula o checksum de um registro
+ *
+ * @param[in]  r     O registro
+ *
+ * @return     FNV-1a dos bytes anteriores ao checksum
+ */
+std::uint64_t Checkpoint::checksum_of( const checkpoint::Record & r )
+{
+	auto bytes = reinterpret_cast< const unsigned char * >( &r );
+	std::uint64_t h = 14695981039346656037ull;
+
+	for ( std::size_t i = 0; i < offsetof( checkpoint::Record, checksum ); ++i )
+	{
+		h ^= bytes[ i ];
+		h *= 1099511628211ull;
+	}
+
+	return h;
+}
+
+/**
+ * @brief      Lê o progresso gravado
+ *
+ * @param[out] state  O progresso
+ *
+ * @return     Vazio se leu ( state zerado se o arquivo não existe ), ou a
+ *             descrição do erro se o arquivo é inválido
+ */
+std::string Checkpoint::load( checkpoint::State & state ) const
+{
+	state = checkpoint::State();
+
+	int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+	if ( fd < 0 )
+	{
+		return errno == ENOENT ? "" : "cannot open " + path + ": " + std::strerror( errno );
+	}
+
+	checkpoint::Record r;
+	auto n = ::read( fd, &r, sizeof( r ) );
+	::close( fd );
+
+	if ( n != static_cast< ssize_t >( sizeof( r ) )
+		or std::memcmp( r.magic, checkpoint::MAGIC, sizeof( r.magic ) ) != 0
+		or r.version != checkpoint::VERSION
+		or r.checksum != checksum_of( r ) )
+	{
+		return "not a valid bares checkpoint: " + path;
+	}
+
+	state = r.state;
+	return "";
+}
+
+/**
+ * @brief      Substitui o progresso gravado de forma atômica
+ *
+ * @param[in]  state  O progresso
+ *
+ * @return     Vazio se gravou, ou a descrição do erro
+ */
+std::string Checkpoint::save( const checkpoint::State & state ) const
+{
+	checkpoint::Record r{};
+	std::memcpy( r.magic, checkpoint::MAGIC, sizeof( r.magic ) );
+	r.version = checkpoint::VERSION;
+	r.state = state;
+	r.checksum = checksum_of( r );
+
+	auto tmp = path + ".tmp";
+	int fd = ::open( tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	if ( fd < 0 )
+	{
+		return "cannot create " + tmp + ": " + std::strerror( errno );
+	}
+
+	bool ok = ::write( fd, &r, sizeof( r ) ) == static_cast< ssize_t >( sizeof( r ) ) and fsync( fd ) == 0;
+	auto err = errno;
+	::close( fd );
+
+	if ( not ok or ::rename( tmp.c_str(), path.c_str() ) != 0 )
+	{
+		err = ok ? errno : err;
+		unlink( tmp.c_str() );
+		return "cannot write " + path + ": " + std::strerror( err );
+	}
+
+	// A troca de nome só é durável depois do fsync do diretório
+	auto slash = path.rfind( '/' );
+	auto dir = slash == std::string::npos ? std::string( "." ) : path.substr( 0, slash + 1 );
+	int dfd = ::open( dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC );
+	if ( dfd >= 0 )
+	{
+		fsync( dfd );
+		::close( dfd );
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Apaga o arquivo ( a execução terminou )
+ */
+void Checkpoint::remove( void ) const
+{
+	unlink( path.c_str() );
+}
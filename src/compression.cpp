@@ -0,0 +1,648 @@
+/**
+ * @file compression.cpp
+ * @brief      Implementação dos métodos das classes LineSource e
+ *             StreamCompressor
+ * @details    A thread de leitura do LineSource alterna entre os dois buffers:
+ *             espera o próximo ficar livre, enche-o ( lendo direto nele, ou
+ *             descomprimindo ) e o entrega. A thread de avaliação devolve cada
+ *             buffer assim que separa a última linha dele.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno
+#include <cstring>  	// std::memchr, std::memcpy, std::strerror
+
+#include <unistd.h> 	// read, write
+
+#if defined( BARES_HAS_ZLIB )
+#include <zlib.h>   	// inflate, deflate
+#endif
+#if defined( BARES_HAS_ZSTD )
+#include <zstd.h>   	// ZSTD_decompressStream, ZSTD_compressStream2
+#endif
+
+#include "compression.hpp"
+
+constexpr LineSource::size_type LineSource::BLOCK;
+
+namespace
+{
+	/**
+	 * @brief      read(2) que repete se for interrompido por um sinal
+	 */
+	ssize_t read_some( int fd, void * buf, std::size_t n )
+	{
+		ssize_t r;
+		do
+		{
+			r = ::read( fd, buf, n );
+		} while ( r < 0 and errno == EINTR );
+		return r;
+	}
+
+	/**
+	 * @brief      Grava todos os bytes, repetindo escritas parciais
+	 */
+	bool write_all( int fd, const void * buf, std::size_t n )
+	{
+		auto p = static_cast< const char * >( buf );
+		while ( n > 0 )
+		{
+			auto w = ::write( fd, p, n );
+			if ( w < 0 and errno == EINTR )
+			{
+				continue;
+			}
+			if ( w <= 0 )
+			{
+				return false;
+			}
+			p += w;
+			n -= w;
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief      Reconhece o formato pelos primeiros bytes
+ *
+ * @param[in]  data  Início do conteúdo
+ * @param[in]  n     Bytes disponíveis
+ *
+ * @return     O formato ( NONE se não for comprimido )
+ */
+compression::format_t compression::detect( const unsigned char * data, std::size_t n )
+{
+	if ( n >= 2 and data[0] == 0x1f and data[1] == 0x8b )
+	{
+		return format_t::GZIP;
+	}
+	if ( n >= 4 and data[0] == 0x28 and data[1] == 0xb5 and data[2] == 0x2f and data[3] == 0xfd )
+	{
+		return format_t::ZSTD;
+	}
+	return format_t::NONE;
+}
+
+/**
+ * @brief      Informa se o formato foi incluído na compilação
+ *
+ * @param[in]  format  O formato
+ *
+ * @return     True se pode ser lido e escrito
+ */
+bool compression::is_supported( format_t format )
+{
+	switch ( format )
+	{
+		case format_t::NONE:
+			return true;
+#if defined( BARES_HAS_ZLIB )
+		case format_t::GZIP:
+			return true;
+#endif
+#if defined( BARES_HAS_ZSTD )
+		case format_t::ZSTD:
+			return true;
+#endif
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief      Converte um nome ( "gzip", "zstd" ) em formato
+ *
+ * @param[in]  name    O nome
+ * @param[out] format  O formato
+ *
+ * @return     True se o nome é conhecido
+ */
+bool compression::from_name( const std::string & name, format_t & format )
+{
+	if ( name == "gzip" or name == "gz" )
+	{
+		format = format_t::GZIP;
+	}
+	else if ( name == "zstd" or name == "zst" )
+	{
+		format = format_t::ZSTD;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief      Construtor do LineSource, inicia a thread de leitura
+ *
+ * @param[in]  fd    Descritor a ser lido
+ */
+LineSource::LineSource( int fd )
+	: shared( std::make_shared< Shared >() )
+{
+	shared->fd = fd;
+	shared->buffers[0].data.resize( BLOCK );
+	shared->buffers[1].data.resize( BLOCK );
+
+	producer = std::thread( produce, shared );
+}
+
+/**
+ * @brief      Destrutor, encerra a thread de leitura
+ */
+LineSource::~LineSource()
+{
+	bool finished;
+	{
+		std::lock_guard< std::mutex > guard( shared->lock );
+		shared->stopped = true;
+		finished = shared->finished;
+	}
+	shared->changed.notify_all();
+
+	// Parada antes do fim ( por exemplo com "q" ): a thread pode estar presa
+	// em um read da entrada padrão e termina sozinha; o estado é dela também
+	if ( finished )
+	{
+		producer.join();
+	}
+	else
+	{
+		producer.detach();
+	}
+}
+
+/**
+ * @brief      Corpo da thread de leitura
+ *
+ * @param[in]  s     Estado dividido com o LineSource
+ */
+void LineSource::produce( std::shared_ptr< Shared > s )
+{
+	size_type index = 0;
+
+	// Espera o próximo buffer ser devolvido; nullptr se o LineSource parou
+	auto take = [&]() -> Buffer *
+	{
+		std::unique_lock< std::mutex > guard( s->lock );
+		s->changed.wait( guard, [&]() { return not s->buffers[ index ].ready or s->stopped; } );
+		if ( s->stopped )
+		{
+			return nullptr;
+		}
+		s->buffers[ index ].size = 0;
+		return &s->buffers[ index ];
+	};
+
+	auto publish = [&]( Buffer * b )
+	{
+		{
+			std::lock_guard< std::mutex > guard( s->lock );
+			b->ready = true;
+		}
+		s->changed.notify_all();
+		index ^= 1;
+	};
+
+	auto fail = [&]( const std::string & message )
+	{
+		std::lock_guard< std::mutex > guard( s->lock );
+		s->error = message;
+	};
+
+	// Entrega o buffer se tiver algo e pega o próximo
+	auto rotate = [&]( Buffer *& b ) -> bool
+	{
+		if ( b->size > 0 )
+		{
+			publish( b );
+			b = take();
+		}
+		return b != nullptr;
+	};
+
+	std::vector< unsigned char > raw( BLOCK );
+	Buffer * out = take();
+
+	// Os primeiros bytes decidem o formato
+	ssize_t raw_size = 0;
+	while ( out != nullptr and raw_size < 4 )
+	{
+		auto r = read_some( s->fd, raw.data() + raw_size, BLOCK - raw_size );
+		if ( r <= 0 )
+		{
+			if ( r < 0 )
+			{
+				fail( std::string( "cannot read input: " ) + std::strerror( errno ) );
+				out = nullptr;
+			}
+			break;
+		}
+		raw_size += r;
+	}
+
+	auto format = compression::detect( raw.data(), raw_size );
+
+	if ( out == nullptr )
+	{
+		// Parado ou falhou antes de começar
+	}
+	else if ( not compression::is_supported( format ) )
+	{
+		fail( format == compression::format_t::GZIP ? "gzip input, but bares was built without zlib"
+		                                            : "zstd input, but bares was built without zstd" );
+	}
+	else if ( format == compression::format_t::NONE )
+	{
+		// Sem compressão: as leituras seguintes vão direto para os buffers
+		std::memcpy( out->data.data(), raw.data(), raw_size );
+		out->size = raw_size;
+
+		while ( rotate( out ) )
+		{
+			auto r = read_some( s->fd, out->data.data(), BLOCK );
+			if ( r < 0 )
+			{
+				fail( std::string( "cannot read input: " ) + std::strerror( errno ) );
+			}
+			if ( r <= 0 )
+			{
+				break;
+			}
+			out->size = r;
+		}
+	}
+#if defined( BARES_HAS_ZLIB )
+	else if ( format == compression::format_t::GZIP )
+	{
+		z_stream zs;
+		std::memset( &zs, 0, sizeof( zs ) );
+
+		// 15 + 32: janela máxima, cabeçalho gzip ou zlib reconhecido sozinho
+		bool ended = false;
+		bool ok = inflateInit2( &zs, 15 + 32 ) == Z_OK;
+
+		while ( ok and raw_size > 0 )
+		{
+			zs.next_in = raw.data();
+			zs.avail_in = static_cast< uInt >( raw_size );
+
+			while ( ok and zs.avail_in > 0 )
+			{
+				if ( ended )
+				{
+					// Arquivos gzip concatenados são um único fluxo
+					inflateReset( &zs );
+					ended = false;
+				}
+
+				zs.next_out = reinterpret_cast< Bytef * >( out->data.data() + out->size );
+				zs.avail_out = static_cast< uInt >( BLOCK - out->size );
+
+				auto r = inflate( &zs, Z_NO_FLUSH );
+				out->size = BLOCK - zs.avail_out;
+
+				if ( r == Z_STREAM_END )
+				{
+					ended = true;
+				}
+				else if ( r != Z_OK and r != Z_BUF_ERROR )
+				{
+					fail( "corrupt gzip input" );
+					ok = false;
+				}
+
+				if ( ok and out->size == BLOCK )
+				{
+					ok = rotate( out );
+				}
+			}
+
+			if ( ok )
+			{
+				ok = rotate( out );
+			}
+			if ( ok )
+			{
+				raw_size = read_some( s->fd, raw.data(), BLOCK );
+				if ( raw_size < 0 )
+				{
+					fail( std::string( "cannot read input: " ) + std::strerror( errno ) );
+					ok = false;
+				}
+			}
+		}
+
+		if ( ok and not ended )
+		{
+			fail( "truncated gzip input" );
+		}
+		if ( ok and out->size > 0 )
+		{
+			rotate( out );
+		}
+
+		inflateEnd( &zs );
+	}
+#endif
+#if defined( BARES_HAS_ZSTD )
+	else if ( format == compression::format_t::ZSTD )
+	{
+		auto ds = ZSTD_createDStream();
+		bool ok = ds != nullptr and not ZSTD_isError( ZSTD_initDStream( ds ) );
+		std::size_t pending = 0; // 0 quando um quadro terminou por completo
+		bool full = false;       // A última chamada encheu o buffer de saída
+
+		while ( ok and raw_size > 0 )
+		{
+			ZSTD_inBuffer in = { raw.data(), static_cast< std::size_t >( raw_size ), 0 };
+
+			while ( ok and ( in.pos < in.size or full ) )
+			{
+				ZSTD_outBuffer o = { out->data.data(), BLOCK, out->size };
+
+				pending = ZSTD_decompressStream( ds, &o, &in );
+				out->size = o.pos;
+				full = o.pos == o.size;
+
+				if ( ZSTD_isError( pending ) )
+				{
+					fail( std::string( "corrupt zstd input: " ) + ZSTD_getErrorName( pending ) );
+					ok = false;
+				}
+				else if ( full )
+				{
+					ok = rotate( out );
+				}
+			}
+
+			if ( ok )
+			{
+				ok = rotate( out );
+			}
+			if ( ok )
+			{
+				raw_size = read_some( s->fd, raw.data(), BLOCK );
+				if ( raw_size < 0 )
+				{
+					fail( std::string( "cannot read input: " ) + std::strerror( errno ) );
+					ok = false;
+				}
+			}
+		}
+
+		if ( ok and pending != 0 )
+		{
+			fail( "truncated zstd input" );
+		}
+		if ( ok and out->size > 0 )
+		{
+			rotate( out );
+		}
+
+		ZSTD_freeDStream( ds );
+	}
+#endif
+
+	{
+		std::lock_guard< std::mutex > guard( s->lock );
+		s->finished = true;
+	}
+	s->changed.notify_all();
+}
+
+/**
+ * @brief      Espera o próximo buffer cheio
+ *
+ * @return     False se a entrada acabou
+ */
+bool LineSource::acquire( void )
+{
+	std::unique_lock< std::mutex > guard( shared->lock );
+
+	if ( holding )
+	{
+		// Devolve o buffer consumido para a thread de leitura
+		shared->buffers[ current ].ready = false;
+		holding = false;
+		current ^= 1;
+		shared->changed.notify_all();
+	}
+
+	shared->changed.wait( guard, [this]() { return shared->buffers[ current ].ready or shared->finished; } );
+
+	if ( not shared->buffers[ current ].ready )
+	{
+		eof = true;
+		return false;
+	}
+
+	holding = true;
+	pos = 0;
+	return true;
+}
+
+/**
+ * @brief      Lê a próxima linha, como std::getline
+ *
+ * @param[out] line  A linha, sem o '\n'
+ *
+ * @return     False se a entrada acabou ( ou falhou )
+ */
+bool LineSource::next( std::string & line )
+{
+	line.clear();
+	bool extracted = false;
+
+	while ( not eof )
+	{
+		if ( not holding or pos == shared->buffers[ current ].size )
+		{
+			if ( not acquire() )
+			{
+				break;
+			}
+			continue;
+		}
+
+		const auto & b = shared->buffers[ current ];
+		auto begin = b.data.data() + pos;
+		auto end = b.data.data() + b.size;
+		auto nl = static_cast< const char * >( std::memchr( begin, '\n', end - begin ) );
+
+		extracted = true;
+
+		if ( nl != nullptr )
+		{
+			line.append( begin, nl );
+			pos += nl - begin + 1;
+			return true;
+		}
+
+		// A linha continua no próximo buffer
+		line.append( begin, end );
+		pos = b.size;
+	}
+
+	return extracted;
+}
+
+/**
+ * @brief      Recupera o erro de leitura
+ *
+ * @return     A mensagem, vazia se a entrada acabou normalmente
+ */
+std::string LineSource::error( void ) const
+{
+	std::lock_guard< std::mutex > guard( shared->lock );
+	return shared->error;
+}
+
+/**
+ * @brief      Construtor do StreamCompressor, inicia a thread
+ *
+ * @param[in]  in_      Descritor de onde ler os dados
+ * @param[in]  out_     Descritor onde gravar os dados comprimidos
+ * @param[in]  format_  GZIP ou ZSTD
+ */
+StreamCompressor::StreamCompressor( int in_, int out_, compression::format_t format_ )
+	: in( in_ )
+	, out( out_ )
+	, format( format_ )
+{
+	worker = std::thread( &StreamCompressor::run, this );
+}
+
+/**
+ * @brief      Destrutor, espera a thread terminar
+ */
+StreamCompressor::~StreamCompressor()
+{
+	if ( worker.joinable() )
+	{
+		worker.join();
+	}
+}
+
+/**
+ * @brief      Espera o fim da entrada e da compressão
+ *
+ * @return     Vazio se tudo foi gravado, ou a descrição do erro
+ */
+std::string StreamCompressor::finish( void )
+{
+	if ( worker.joinable() )
+	{
+		worker.join();
+	}
+	return failure;
+}
+
+/**
+ * @brief      Corpo da thread de compressão
+ */
+void StreamCompressor::run( void )
+{
+	std::vector< unsigned char > src( 1 << 16 );
+	std::vector< unsigned char > dst( 1 << 17 );
+	bool ok = compression::is_supported( format ) and format != compression::format_t::NONE;
+
+	if ( not ok )
+	{
+		failure = "output compression not available in this build";
+	}
+
+#if defined( BARES_HAS_ZLIB )
+	z_stream zs;
+	std::memset( &zs, 0, sizeof( zs ) );
+	if ( ok and format == compression::format_t::GZIP )
+	{
+		// 15 + 16: janela máxima com cabeçalho gzip
+		ok = deflateInit2( &zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY ) == Z_OK;
+	}
+#endif
+#if defined( BARES_HAS_ZSTD )
+	ZSTD_CStream * cs = nullptr;
+	if ( ok and format == compression::format_t::ZSTD )
+	{
+		cs = ZSTD_createCStream();
+		ok = cs != nullptr and not ZSTD_isError( ZSTD_initCStream( cs, 3 ) );
+	}
+#endif
+
+	if ( not ok and failure.empty() )
+	{
+		failure = "cannot initialize the output compressor";
+	}
+
+	ssize_t n;
+	do
+	{
+		n = read_some( in, src.data(), src.size() );
+		if ( n < 0 )
+		{
+			failure = std::string( "cannot read output: " ) + std::strerror( errno );
+			break;
+		}
+
+		// Depois de um erro o pipe continua sendo esvaziado, para quem
+		// escreve nele não ficar bloqueado
+		if ( not ok )
+		{
+			continue;
+		}
+
+#if defined( BARES_HAS_ZLIB )
+		if ( format == compression::format_t::GZIP )
+		{
+			zs.next_in = src.data();
+			zs.avail_in = static_cast< uInt >( n );
+			do
+			{
+				zs.next_out = dst.data();
+				zs.avail_out = static_cast< uInt >( dst.size() );
+				deflate( &zs, n == 0 ? Z_FINISH : Z_NO_FLUSH );
+				ok = write_all( out, dst.data(), dst.size() - zs.avail_out );
+			} while ( ok and zs.avail_out == 0 );
+		}
+#endif
+#if defined( BARES_HAS_ZSTD )
+		if ( format == compression::format_t::ZSTD )
+		{
+			ZSTD_inBuffer input = { src.data(), static_cast< std::size_t >( n ), 0 };
+			std::size_t remaining;
+			do
+			{
+				ZSTD_outBuffer o = { dst.data(), dst.size(), 0 };
+				remaining = ZSTD_compressStream2( cs, &o, &input, n == 0 ? ZSTD_e_end : ZSTD_e_continue );
+				ok = not ZSTD_isError( remaining ) and write_all( out, dst.data(), o.pos );
+			} while ( ok and ( n == 0 ? remaining != 0 : input.pos < input.size ) );
+		}
+#endif
+
+		if ( not ok and failure.empty() )
+		{
+			failure = std::string( "cannot write compressed output: " ) + std::strerror( errno );
+		}
+	} while ( n > 0 );
+
+#if defined( BARES_HAS_ZLIB )
+	if ( format == compression::format_t::GZIP )
+	{
+		deflateEnd( &zs );
+	}
+#endif
+#if defined( BARES_HAS_ZSTD )
+	if ( cs != nullptr )
+	{
+		ZSTD_freeCStream( cs );
+	}
+#endif
+}
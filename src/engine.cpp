@@ -0,0 +1,59 @@
+/**
+ * @file engine.cpp
+ * @brief      Implementação dos métodos da classe Engine
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include "engine.hpp"
+
+constexpr std::size_t Engine::CACHE_LINE;
+
+/**
+ * @brief      Avalia uma expressão usando o contexto informado
+ *
+ * @param[in]  expr  A expressão
+ * @param      ctx   Contexto exclusivo de quem chama durante a chamada
+ *
+ * @return     Os mesmos resultados de Parser::parse e
+ *             Evaluator::evaluate_postfix
+ */
+Engine::Result Engine::evaluate( const std::string & expr, Context & ctx ) const
+{
+	Result result;
+
+	result.parsed = ctx.parser.parse( expr );
+
+	if ( result.parsed.type == Parser::ParserResult::PARSER_OK )
+	{
+		result.evaluated = ctx.evaluator.evaluate_postfix( ctx.evaluator.infix_to_postfix( ctx.parser.get_tokens() ) );
+	}
+
+	return result;
+}
+
+/**
+ * @brief      Avalia uma expressão usando o contexto da thread atual
+ *
+ * @param[in]  expr  A expressão
+ *
+ * @return     Os mesmos resultados de Parser::parse e
+ *             Evaluator::evaluate_postfix
+ */
+Engine::Result Engine::evaluate( const std::string & expr ) const
+{
+	return evaluate( expr, local_context() );
+}
+
+/**
+ * @brief      Recupera o contexto da thread atual, criado no primeiro uso
+ *
+ * @return     O contexto
+ */
+Engine::Context & Engine::local_context( void )
+{
+	thread_local Context ctx;
+	return ctx;
+}
@@ -13,6 +13,7 @@
 
 #include "evaluator.hpp"
 #include "parser.hpp"
+#include "operators.hpp"
 
 using value_type = long int;
 
@@ -91,7 +92,7 @@ bool Evaluator::is_closing_scope ( Token tok )
  */
 bool Evaluator::is_right_association ( Token tok )
 {
-	return tok.value == "^";
+	return bares::is_right_associative( tok.value[0] );
 }
 
 /**
@@ -103,19 +104,7 @@ bool Evaluator::is_right_association ( Token tok )
  */
 short Evaluator::get_precedence ( char c )
 {
-	switch( c )
-	{
-		case '^': return 3;
-		// ==================================================
-		case '*':
-		case '%':
-		case '/': return 2;
-		// ==================================================
-		case '+':
-		case '-': return 1;
-		// ==================================================
-		default: return 0;
-	}
+	return bares::precedence( c );
 }
 
 /**
@@ -128,15 +117,7 @@ short Evaluator::get_precedence ( char c )
  */
 bool Evaluator::has_higher_precedence ( Token op1, Token op2 )
 {
-	short w1 = get_precedence( op1.value[0] );
-	short w2 = get_precedence( op2.value[0] );
-
-	if ( w1 == w2 and is_right_association( op1 ) )
-	{
-		return false;
-	}
-
-	return w1 >= w2 ;
+	return bares::has_higher_precedence( op1.value[0], op2.value[0] );
 }
 
 /**
@@ -155,46 +136,23 @@ Evaluator::EvaluatorResult Evaluator::execute_operator ( value_type term1, value
 	Evaluator::EvaluatorResult result;
 	result.value = 0;
 
-	value_type result_aux;
+	// Uma consulta à tabela no lugar do switch pelo símbolo
+	const auto & entry = bares::OPERATORS[ bares::operator_index( op ) ];
 
-	switch ( op )
+	if ( entry.checks_divisor and term2 == 0 )
 	{
-		case '+' : result_aux = term1 + term2;
-			break;
-		case '-' : result_aux = term1 - term2;
-			break;
-		case '*' : result_aux = term1 * term2;
-			break;			
-		case '^' : result_aux = ( pow( term1, term2 ) );
-			break;
-		case '/' : 
-			if ( term2 == 0 )
-			{
-				result.type = EvaluatorResult::code_t::DIVISION_BY_ZERO;
-			}
-			else
-			{
-				result_aux = term1/term2;	
-			}		
-			break;
-		case '%' :
-			if ( term2 == 0 )
-			{
-				result.type = EvaluatorResult::code_t::DIVISION_BY_ZERO;
-			}
-			else
-			{
-				result_aux = term1%term2;
-			}		
-			break;
+		result.type = EvaluatorResult::code_t::DIVISION_BY_ZERO;
+		return result;
 	}
 
+	value_type result_aux = entry.kernel( term1, term2 );
+
 	if( result_aux <= std::numeric_limits< Parser::required_int_type >::max() 
         and result_aux >= std::numeric_limits< Parser::required_int_type >::min())
 	{
 		result.value = result_aux;
 	}
-	else if (result.type != EvaluatorResult::code_t::DIVISION_BY_ZERO)
+	else
 	{
 		result.type = EvaluatorResult::code_t::NUMERIC_OVERFLOW;
 	}
@@ -0,0 +1,175 @@
+/**
+ * @file expression_dag.cpp
+ * @brief      Implementação dos métodos da classe ExpressionDag
+ * @details    Constrói o grafo linha a linha a partir da posfixa, com uma
+ *             pilha de índices de nós, e depois avalia os nós em ordem.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstdint>  	// std::uint64_t
+#include <string>   	// std::stol
+
+#include "expression_dag.hpp"
+#include "stack.hpp"	// jv::stack
+
+constexpr ExpressionDag::size_type ExpressionDag::NIL;
+
+/**
+ * @brief      Hash da identidade estrutural
+ *
+ * @param[in]  k     A identidade
+ *
+ * @return     O hash
+ */
+ExpressionDag::size_type ExpressionDag::KeyHash::operator()( const Key & k ) const
+{
+	// Mistura multiplicativa: os índices são pequenos e sequenciais
+	std::uint64_t h = static_cast< unsigned char >( k.op );
+	h = ( h ^ k.left ) * 0x9e3779b97f4a7c15ull;
+	h = ( h ^ ( h >> 29 ) ^ k.right ) * 0xbf58476d1ce4e5b9ull;
+	return static_cast< size_type >( h ^ ( h >> 32 ) );
+}
+
+/**
+ * @brief      Procura o nó com a identidade informada, criando-o se ainda não
+ *             existe
+ *
+ * @param[in]  key   A identidade
+ *
+ * @return     Índice do nó
+ */
+ExpressionDag::size_type ExpressionDag::intern( const Key & key )
+{
+	auto found = unique.emplace( key, nodes.size() );
+
+	if ( found.second )
+	{
+		nodes.push_back( Node{ key.op, key.left, key.right, 0, code_t::RESULT_OK } );
+	}
+
+	return found.first->second;
+}
+
+/**
+ * @brief      Acrescenta ao grafo a expressão posfixa de uma linha
+ *
+ * @param[in]  postfix  Expressão em notação posfixa
+ *
+ * @return     Índice do nó raiz, ou NIL se a expressão é vazia
+ */
+ExpressionDag::size_type ExpressionDag::insert( const std::vector< Token > & postfix )
+{
+	jv::stack< size_type > st( postfix.size() + 1 );
+
+	for ( const Token & s : postfix )
+	{
+		if ( s.type == Token::token_t::OPERAND )
+		{
+			// Literais iguais ( mesmo com grafias diferentes, como "07" e
+			// "7" ) são a mesma folha
+			auto value = static_cast< size_type >( std::stol( s.value ) );
+			st.push( intern( Key{ 0, value, 0 } ) );
+		}
+		else if ( s.type == Token::token_t::OPERATOR )
+		{
+			auto right = st.top(); st.pop();
+			auto left = st.top(); st.pop();
+
+			st.push( intern( Key{ s.value[0], left, right } ) );
+			++operators;
+		}
+	}
+
+	return st.empty() ? NIL : st.top();
+}
+
+/**
+ * @brief      Avalia um lote de expressões
+ *
+ * @param[in]  lines  As expressões, uma por linha
+ *
+ * @return     Um resultado por linha, na ordem da entrada
+ */
+std::vector< ExpressionDag::LineResult > ExpressionDag::evaluate( const std::vector< std::string > & lines )
+{
+	nodes.clear();
+	unique.clear();
+	operators = 0;
+
+	std::vector< LineResult > results( lines.size() );
+	std::vector< size_type > roots( lines.size(), NIL );
+
+	for ( size_type i = 0; i < lines.size(); ++i )
+	{
+		results[ i ].parsed = parser.parse( lines[ i ] );
+
+		if ( results[ i ].parsed.type == Parser::ParserResult::PARSER_OK )
+		{
+			roots[ i ] = insert( evaluator.infix_to_postfix( parser.get_tokens() ) );
+		}
+	}
+
+	// Ordem topológica: cada nó é avaliado uma vez, depois dos filhos
+	for ( auto & n : nodes )
+	{
+		if ( n.op == 0 )
+		{
+			n.value = static_cast< value_type >( n.left );
+			continue;
+		}
+
+		auto result = Evaluator::execute_operator( nodes[ n.left ].value, nodes[ n.right ].value, n.op );
+
+		n.value = result.value;
+		n.type = result.type;
+	}
+
+	for ( size_type i = 0; i < lines.size(); ++i )
+	{
+		if ( roots[ i ] != NIL )
+		{
+			results[ i ].evaluated = Evaluator::EvaluatorResult( nodes[ roots[ i ] ].value, nodes[ roots[ i ] ].type );
+		}
+	}
+
+	return results;
+}
+
+/**
+ * @brief      Informa quantos nós únicos o último lote formou
+ *
+ * @return     Quantidade de nós ( literais e operadores )
+ */
+ExpressionDag::size_type ExpressionDag::node_count( void ) const
+{
+	return nodes.size();
+}
+
+/**
+ * @brief      Informa quantas operações o último lote teria sem o
+ *             compartilhamento
+ *
+ * @return     Soma da quantidade de operadores de cada linha
+ */
+ExpressionDag::size_type ExpressionDag::operator_count( void ) const
+{
+	return operators;
+}
+
+/**
+ * @brief      Informa quantas operações o último lote de fato executou
+ *
+ * @return     Quantidade de nós de operador únicos
+ */
+ExpressionDag::size_type ExpressionDag::evaluated_count( void ) const
+{
+	size_type count = 0;
+	for ( const auto & n : nodes )
+	{
+		count += n.op != 0;
+	}
+	return count;
+}
@@ -0,0 +1,419 @@
+/**
+ * @file expression_tree.cpp
+ * @brief      Implementação dos métodos da classe ExpressionTree
+ * @details    Constrói uma árvore persistente a partir da expressão posfixa,
+ *             guardando o valor de cada subárvore. Ao trocar um literal apenas
+ *             as cadeias entre a folha alterada e a raiz são recalculadas,
+ *             cada uma pela sua árvore de segmentos.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::lower_bound, std::min, std::max
+#include <limits>   	// std::numeric_limits
+#include <string>   	// std::stol
+
+#include "expression_tree.hpp"
+#include "stack.hpp"	// jv::stack
+
+constexpr ExpressionTree::size_type ExpressionTree::NIL;
+
+namespace
+{
+	using value_type = ExpressionTree::value_type;
+
+	constexpr value_type MIN = std::numeric_limits< Parser::required_int_type >::min();
+	constexpr value_type MAX = std::numeric_limits< Parser::required_int_type >::max();
+
+	/**
+	 * @brief      Divisão arredondada para baixo
+	 */
+	value_type floor_div( value_type x, value_type d )
+	{
+		auto q = x / d;
+		return ( x % d != 0 and ( x < 0 ) != ( d < 0 ) ) ? q - 1 : q;
+	}
+
+	/**
+	 * @brief      Divisão arredondada para cima
+	 */
+	value_type ceil_div( value_type x, value_type d )
+	{
+		auto q = x / d;
+		return ( x % d != 0 and ( x < 0 ) == ( d < 0 ) ) ? q + 1 : q;
+	}
+}
+
+/**
+ * @brief      Constrói a árvore a partir de uma expressão posfixa
+ *
+ * @param[in]  postfix  Expressão em notação posfixa
+ */
+ExpressionTree::ExpressionTree( const std::vector< Token > & postfix )
+{
+	build( postfix );
+}
+
+/**
+ * @brief      Descarta a árvore atual e constrói uma nova a partir da
+ *             expressão posfixa informada, avaliando todos os nós
+ *
+ * @param[in]  postfix  Expressão em notação posfixa
+ */
+void ExpressionTree::build( const std::vector< Token > & postfix )
+{
+	nodes.clear();
+	literals.clear();
+	chains.clear();
+	root = NIL;
+
+	nodes.reserve( postfix.size() );
+
+	jv::stack< size_type > st( postfix.size() + 1 );
+
+	for ( const Token & s : postfix )
+	{
+		if ( s.type == Token::token_t::OPERAND )
+		{
+			literals.push_back( nodes.size() );
+			st.push( nodes.size() );
+			nodes.push_back( Node{ std::stol( s.value ), code_t::RESULT_OK, 0, NIL, NIL, NIL, s.col, NIL, 0 } );
+		}
+		else if ( s.type == Token::token_t::OPERATOR )
+		{
+			auto right = st.top(); st.pop();
+			auto left = st.top(); st.pop();
+
+			auto id = nodes.size();
+			nodes.push_back( Node{ 0, code_t::RESULT_OK, s.value[0], left, right, NIL, s.col, NIL, 0 } );
+			nodes[ left ].parent = id;
+			nodes[ right ].parent = id;
+
+			// Um operador à esquerda continua a sua cadeia; um literal começa
+			// uma nova
+			if ( nodes[ left ].op != 0 )
+			{
+				nodes[ id ].chain = nodes[ left ].chain;
+			}
+			else
+			{
+				nodes[ id ].chain = chains.size();
+				chains.push_back( Chain{ left, {}, {} } );
+			}
+			nodes[ id ].pos = chains[ nodes[ id ].chain ].ops.size();
+			chains[ nodes[ id ].chain ].ops.push_back( id );
+
+			recompute( id );
+			st.push( id );
+		}
+	}
+
+	if ( not st.empty() )
+	{
+		root = st.top();
+	}
+
+	for ( auto & c : chains )
+	{
+		c.seg.resize( 2 * c.ops.size() - 1 );
+		update( c, 0, 0, c.ops.size(), NIL );
+	}
+}
+
+/**
+ * @brief      Recalcula o valor de um nó interno a partir dos filhos
+ *
+ * @param[in]  id    Índice do nó
+ */
+void ExpressionTree::recompute( size_type id )
+{
+	Node & n = nodes[ id ];
+
+	auto result = Evaluator::execute_operator( nodes[ n.left ].value, nodes[ n.right ].value, n.op );
+
+	n.value = result.value;
+	n.type = result.type;
+}
+
+/**
+ * @brief      Função de uma única operação com o termo direito fixo
+ *
+ * @param[in]  op     Operador
+ * @param[in]  right  Valor do termo direito
+ *
+ * @return     O segmento, não linear para "/", "%" e "^"
+ */
+ExpressionTree::Piece ExpressionTree::piece( char op, value_type right )
+{
+	// v -> v + right, v - right ou v * right, para qualquer v da faixa
+	Piece f{ true, 1, 0, right, MIN, MAX };
+
+	switch ( op )
+	{
+		case '+': break;
+		case '-': f.y0 = -right; break;
+		case '*': f.a = right; f.y0 = 0; break;
+		default : return Piece{ false, 0, 0, 0, 0, 0 };
+	}
+
+	// Restringe às entradas cujo resultado cabe na faixa: f seguida da
+	// identidade, que só aceita valores da faixa
+	return compose( f, Piece{ true, 1, MIN, MIN, MIN, MAX } );
+}
+
+/**
+ * @brief      Função de um segmento seguido de outro
+ *
+ * @param[in]  f     Segmento aplicado primeiro
+ * @param[in]  g     Segmento aplicado depois
+ *
+ * @return     O segmento g( f( v ) )
+ */
+ExpressionTree::Piece ExpressionTree::compose( const Piece & f, const Piece & g )
+{
+	Piece h{ false, 0, 0, 0, f.lo, f.hi };
+
+	if ( not f.linear or not g.linear )
+	{
+		return h;
+	}
+
+	// Entradas de f cuja saída está em [g.lo, g.hi]. Em [f.lo, f.hi] as
+	// saídas de f cabem na faixa, então nenhuma conta abaixo estoura
+	if ( f.a == 0 )
+	{
+		if ( f.y0 < g.lo or f.y0 > g.hi )
+		{
+			return h;
+		}
+	}
+	else if ( f.a > 0 )
+	{
+		h.lo = std::max( h.lo, f.v0 + ceil_div( g.lo - f.y0, f.a ) );
+		h.hi = std::min( h.hi, f.v0 + floor_div( g.hi - f.y0, f.a ) );
+	}
+	else
+	{
+		h.lo = std::max( h.lo, f.v0 + ceil_div( g.hi - f.y0, f.a ) );
+		h.hi = std::min( h.hi, f.v0 + floor_div( g.lo - f.y0, f.a ) );
+	}
+
+	if ( h.lo > h.hi )
+	{
+		return h;
+	}
+
+	// Com duas entradas distintas sem estouro, |a| não passa do tamanho da
+	// faixa; com uma só, a inclinação não é usada
+	h.linear = true;
+	h.v0 = h.lo;
+	h.y0 = g.y0 + g.a * ( f.y0 + f.a * ( h.v0 - f.v0 ) - g.v0 );
+	h.a = h.lo == h.hi ? 0 : f.a * g.a;
+
+	return h;
+}
+
+/**
+ * @brief      Monta ou atualiza a árvore de segmentos de uma cadeia
+ *
+ * @param      c     A cadeia
+ * @param[in]  k     Nó da árvore de segmentos
+ * @param[in]  l     Primeira operação do nó
+ * @param[in]  r     Uma depois da última operação do nó
+ * @param[in]  pos   Operação alterada, ou NIL para montar tudo
+ */
+void ExpressionTree::update( Chain & c, size_type k, size_type l, size_type r, size_type pos )
+{
+	if ( r - l == 1 )
+	{
+		const Node & n = nodes[ c.ops[ l ] ];
+		c.seg[ k ] = piece( n.op, nodes[ n.right ].value );
+		return;
+	}
+
+	// Filho esquerdo em k + 1, direito logo após a subárvore esquerda
+	auto m = l + ( r - l ) / 2;
+	auto left = k + 1;
+	auto right = k + 2 * ( m - l );
+
+	if ( pos == NIL or pos < m )
+	{
+		update( c, left, l, m, pos );
+	}
+	if ( pos == NIL or pos >= m )
+	{
+		update( c, right, m, r, pos );
+	}
+
+	c.seg[ k ] = compose( c.seg[ left ], c.seg[ right ] );
+}
+
+/**
+ * @brief      Aplica as operações [l, r) de uma cadeia a um valor
+ *
+ * @param[in]  c     A cadeia
+ * @param[in]  k     Nó da árvore de segmentos
+ * @param[in]  l     Primeira operação do nó
+ * @param[in]  r     Uma depois da última operação do nó
+ * @param[in]  v     Valor antes da operação l
+ * @param[out] type  Código da última operação aplicada
+ *
+ * @return     Valor depois da operação r - 1
+ */
+ExpressionTree::value_type ExpressionTree::run( const Chain & c, size_type k, size_type l, size_type r, value_type v, code_t & type ) const
+{
+	const Piece & f = c.seg[ k ];
+
+	if ( f.linear and v >= f.lo and v <= f.hi )
+	{
+		type = code_t::RESULT_OK;
+		return f.y0 + f.a * ( v - f.v0 );
+	}
+
+	if ( r - l == 1 )
+	{
+		const Node & n = nodes[ c.ops[ l ] ];
+		auto result = Evaluator::execute_operator( v, nodes[ n.right ].value, n.op );
+		type = result.type;
+		return result.value;
+	}
+
+	auto m = l + ( r - l ) / 2;
+	v = run( c, k + 1, l, m, v, type );
+	return run( c, k + 2 * ( m - l ), m, r, v, type );
+}
+
+/**
+ * @brief      Recupera o resultado da expressão, idêntico ao de
+ *             Evaluator::evaluate_postfix
+ *
+ * @return     EvaluatorResult com o valor e o código da raiz
+ */
+Evaluator::EvaluatorResult ExpressionTree::result( void ) const
+{
+	if ( root == NIL )
+	{
+		return Evaluator::EvaluatorResult();
+	}
+
+	return Evaluator::EvaluatorResult( nodes[ root ].value, nodes[ root ].type );
+}
+
+/**
+ * @brief      Informa a quantidade de literais da expressão
+ *
+ * @return     Número de literais
+ */
+ExpressionTree::size_type ExpressionTree::literal_count( void ) const
+{
+	return literals.size();
+}
+
+/**
+ * @brief      Procura o literal que começa na coluna informada
+ *
+ * @param[in]  col   Coluna ( 0-based ) na expressão original
+ *
+ * @return     Índice do literal, ou NIL se não houver literal na coluna
+ */
+ExpressionTree::size_type ExpressionTree::literal_at_col( std::ptrdiff_t col ) const
+{
+	// Os literais aparecem na posfixa na mesma ordem do texto, logo as colunas
+	// estão ordenadas.
+	auto it = std::lower_bound( literals.begin(), literals.end(), col,
+		[this]( size_type id, std::ptrdiff_t c ) { return nodes[ id ].col < c; } );
+
+	if ( it == literals.end() or nodes[ *it ].col != col )
+	{
+		return NIL;
+	}
+
+	return static_cast< size_type >( std::distance( literals.begin(), it ) );
+}
+
+/**
+ * @brief      Troca o valor do literal de índice informado e recalcula
+ *             apenas o caminho até a raiz
+ *
+ * @param[in]  index  Índice do literal ( ordem em que aparece no texto )
+ * @param[in]  value  Novo valor do literal
+ *
+ * @return     PARSER_OK, ou INTEGER_OUT_OF_RANGE com a coluna do literal
+ *             se o valor não for aceito pelo Parser
+ */
+Parser::ParserResult ExpressionTree::replace_literal( size_type index, value_type value )
+{
+	if ( index >= literals.size() )
+	{
+		return Parser::ParserResult( Parser::ParserResult::code_t::ILL_FORMED_INTEGER );
+	}
+
+	auto id = literals[ index ];
+
+	// Mesma faixa aceita por Parser::integer()
+	if ( value >= std::numeric_limits< Parser::required_int_type >::max()
+		or value <= std::numeric_limits< Parser::required_int_type >::min() )
+	{
+		return Parser::ParserResult( Parser::ParserResult::code_t::INTEGER_OUT_OF_RANGE, nodes[ id ].col );
+	}
+
+	if ( nodes[ id ].value == value )
+	{
+		return Parser::ParserResult();
+	}
+
+	nodes[ id ].value = value;
+
+	// Sobe de cadeia em cadeia: o nó alterado é o início de uma cadeia ou o
+	// termo direito de uma das suas operações, e o topo da cadeia é o termo
+	// direito de uma operação da cadeia de cima ( ou a raiz )
+	for ( auto child = id; nodes[ child ].parent != NIL; )
+	{
+		const Node & p = nodes[ nodes[ child ].parent ];
+		Chain & c = chains[ p.chain ];
+
+		if ( p.right == child )
+		{
+			update( c, 0, 0, c.ops.size(), p.pos );
+		}
+
+		Node & top = nodes[ c.ops.back() ];
+		auto old_value = top.value;
+		auto old_type = top.type;
+
+		top.value = run( c, 0, 0, c.ops.size(), nodes[ c.first ].value, top.type );
+
+		// Se o topo não mudou, o restante do caminho também não muda
+		if ( top.value == old_value and top.type == old_type )
+		{
+			break;
+		}
+
+		child = c.ops.back();
+	}
+
+	return Parser::ParserResult();
+}
+
+/**
+ * @brief      Troca o valor do literal que começa na coluna informada
+ *
+ * @param[in]  col    Coluna ( 0-based ) na expressão original
+ * @param[in]  value  Novo valor do literal
+ *
+ * @return     PARSER_OK, ILL_FORMED_INTEGER se não há literal na coluna
+ *             ou INTEGER_OUT_OF_RANGE se o valor não for aceito
+ */
+Parser::ParserResult ExpressionTree::replace_literal_at_col( std::ptrdiff_t col, value_type value )
+{
+	auto index = literal_at_col( col );
+
+	if ( index == NIL )
+	{
+		return Parser::ParserResult( Parser::ParserResult::code_t::ILL_FORMED_INTEGER, col );
+	}
+
+	return replace_literal( index, value );
+}
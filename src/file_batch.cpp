@@ -0,0 +1,509 @@
+/**
+ * @file file_batch.cpp
+ * @brief      Implementação dos métodos da classe FileBatch
+ * @details    Máquina de estados por arquivo ( abrir, ler, avaliar, gravar )
+ *             conduzida pelas conclusões do io_uring.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::min, std::max
+#include <cassert>  	// assert
+#include <cerrno>   	// errno
+#include <cstring>  	// std::strerror
+#include <iostream> 	// std::cerr
+#include <mutex>    	// std::mutex, std::lock_guard
+#include <thread>   	// std::thread::hardware_concurrency
+
+#include <fcntl.h>  	// open
+#include <sys/eventfd.h>	// eventfd
+#include <sys/stat.h>	// fstat
+#include <unistd.h> 	// read, write, close
+
+#include "file_batch.hpp"
+#include "parser.hpp"
+#include "evaluator.hpp"
+#include "output_writer.hpp"
+
+constexpr FileBatch::size_type FileBatch::WINDOW;
+constexpr unsigned FileBatch::RING_ENTRIES;
+constexpr std::uint32_t FileBatch::CHUNK;
+
+namespace
+{
+	/**
+	 * @brief      Etiqueta da leitura do eventfd no anel
+	 */
+	constexpr std::uint64_t EVENT_TAG = ~0ull;
+
+	/**
+	 * @brief      Monta a mensagem de erro de uma operação sobre um arquivo
+	 */
+	std::string describe( const std::string & path, int err )
+	{
+		return path + ": " + std::strerror( err );
+	}
+
+	/**
+	 * @brief      Abre a saída, truncando-a
+	 */
+	int open_output( const std::string & path )
+	{
+		return ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	}
+}
+
+/**
+ * @brief      Construtor do FileBatch
+ *
+ * @param[in]  threads  Threads de avaliação, além da thread de E/S
+ */
+FileBatch::FileBatch( size_type threads )
+	: pool( ( threads == 0 ? std::max( 1u, std::thread::hardware_concurrency() ) : threads ) + 1 )
+	, ring( RING_ENTRIES )
+{ /* Vazio */ }
+
+/**
+ * @brief      Informa se as E/S passam pelo io_uring
+ *
+ * @return     True se o io_uring está disponível
+ */
+bool FileBatch::uses_io_uring( void ) const
+{
+	return ring.is_available();
+}
+
+/**
+ * @brief      Avalia o conteúdo de um arquivo como "bares < arquivo"
+ *
+ * @param[in]  text  Conteúdo do arquivo
+ * @param[in]  n     Tamanho do conteúdo
+ *
+ * @return     A saída que o bares produziria
+ */
+std::vector< char > FileBatch::evaluate( const char * text, size_type n )
+{
+	Parser my_parser;
+	Evaluator my_evaluator;
+	OutputWriter out( OutputWriter::MEMORY );
+
+	size_type begin = 0;
+
+	// Mesmas linhas que std::getline: a última não precisa de '\n'
+	while ( begin < n )
+	{
+		size_type end = begin;
+		while ( end < n and text[ end ] != '\n' )
+		{
+			++end;
+		}
+
+		std::string expr( text + begin, end - begin );
+		begin = end + 1;
+
+		if ( expr == "q" or expr == "p" )
+		{
+			break;
+		}
+
+		auto result = my_parser.parse( expr );
+
+		if ( result.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( result );
+			continue;
+		}
+
+		auto resultado = my_evaluator.evaluate_postfix( my_evaluator.infix_to_postfix( my_parser.get_tokens() ) );
+
+		if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			out.write_evaluator_error( resultado );
+		}
+		else
+		{
+			out.write_value( resultado.value );
+		}
+	}
+
+	return out.release();
+}
+
+/**
+ * @brief      Avalia cada entrada e grava o resultado na saída correspondente
+ *
+ * @param[in]  jobs  Os pares de arquivos
+ *
+ * @return     Quantidade de arquivos que falharam
+ */
+FileBatch::size_type FileBatch::run( const std::vector< Job > & jobs )
+{
+	std::vector< State > states( jobs.size() );
+
+	if ( ring.is_available() )
+	{
+		run_ring( jobs, states );
+	}
+	else
+	{
+		run_sync( jobs, states );
+	}
+
+	size_type failures = 0;
+	for ( const auto & s : states )
+	{
+		if ( not s.error.empty() )
+		{
+			std::cerr << "bares: " << s.error << "\n";
+			++failures;
+		}
+	}
+
+	return failures;
+}
+
+/**
+ * @brief      Processa os arquivos com E/S síncrona, um por tarefa
+ */
+void FileBatch::run_sync( const std::vector< Job > & jobs, std::vector< State > & states )
+{
+	ThreadPool::Group batch;
+
+	for ( size_type i = 0; i < jobs.size(); ++i )
+	{
+		pool.submit( batch, [&jobs, &states, i]()
+		{
+			auto & s = states[ i ];
+			std::vector< char > input;
+
+			int in = ::open( jobs[ i ].input.c_str(), O_RDONLY | O_CLOEXEC );
+			if ( in < 0 )
+			{
+				s.error = describe( jobs[ i ].input, errno );
+				return;
+			}
+
+			char block[ 1 << 16 ];
+			ssize_t r;
+			while ( ( r = ::read( in, block, sizeof( block ) ) ) != 0 )
+			{
+				if ( r < 0 )
+				{
+					if ( errno == EINTR )
+					{
+						continue;
+					}
+					s.error = describe( jobs[ i ].input, errno );
+					::close( in );
+					return;
+				}
+				input.insert( input.end(), block, block + r );
+			}
+			::close( in );
+
+			auto output = evaluate( input.data(), input.size() );
+
+			int out = open_output( jobs[ i ].output );
+			if ( out < 0 )
+			{
+				s.error = describe( jobs[ i ].output, errno );
+				return;
+			}
+
+			OutputWriter writer( out );
+			writer.write( output.data(), output.size() );
+			if ( not writer.flush() )
+			{
+				s.error = describe( jobs[ i ].output, errno );
+			}
+			::close( out );
+		} );
+	}
+
+	pool.wait( batch );
+}
+
+/**
+ * @brief      Processa os arquivos pelo io_uring
+ */
+void FileBatch::run_ring( const std::vector< Job > & jobs, std::vector< State > & states )
+{
+	ThreadPool::Group batch;
+
+	int efd = eventfd( 0, EFD_CLOEXEC );
+	if ( efd < 0 )
+	{
+		run_sync( jobs, states );
+		return;
+	}
+
+	std::mutex ready_lock;
+	std::vector< size_type > ready; // Arquivos avaliados, esperando a escrita
+
+	size_type next = 0;
+	size_type active = 0;
+	size_type finished = 0;
+
+	auto finish = [&]( size_type i )
+	{
+		auto & s = states[ i ];
+		if ( s.in >= 0 )
+		{
+			::close( s.in );
+		}
+		if ( s.out >= 0 )
+		{
+			::close( s.out );
+		}
+		s.in = s.out = -1;
+		s.finished = true;
+		std::vector< char >().swap( s.data );
+
+		--active;
+		++finished;
+	};
+
+	// Fila de submissão cheia: envia o que já foi preparado ao kernel, o
+	// que libera as entradas, e tenta mais uma vez. Se ainda assim não houver
+	// lugar, o arquivo termina com erro em vez de ficar esperando para sempre
+	auto queue_read = [&]( size_type i )
+	{
+		auto & s = states[ i ];
+		auto len = static_cast< std::uint32_t >( std::min< size_type >( CHUNK, s.data.size() - s.done ) );
+		auto offset = s.grow ? ~0ull : s.done; // ~0: a posição atual, a única aceita por pipes
+		if ( not ring.read( s.in, s.data.data() + s.done, len, offset, i )
+			and ( ring.submit( 0 ) != 0 or not ring.read( s.in, s.data.data() + s.done, len, offset, i ) ) )
+		{
+			s.error = describe( jobs[ i ].input, EBUSY );
+			finish( i );
+		}
+	};
+
+	auto queue_write = [&]( size_type i )
+	{
+		auto & s = states[ i ];
+		auto len = static_cast< std::uint32_t >( std::min< size_type >( CHUNK, s.data.size() - s.done ) );
+		if ( not ring.write( s.out, s.data.data() + s.done, len, s.done, i )
+			and ( ring.submit( 0 ) != 0 or not ring.write( s.out, s.data.data() + s.done, len, s.done, i ) ) )
+		{
+			s.error = describe( jobs[ i ].output, EBUSY );
+			finish( i );
+		}
+	};
+
+	// A leitura do eventfd sempre tem lugar: RING_ENTRIES > WINDOW
+	auto arm_event = [&]()
+	{
+		bool queued = ring.read( efd, &event_value, sizeof( event_value ), ~0ull, EVENT_TAG );
+		assert( queued );
+		( void ) queued;
+	};
+
+	// O conteúdo lido vira a saída formatada; a thread de E/S é avisada pelo
+	// eventfd
+	auto dispatch = [&]( size_type i )
+	{
+		pool.submit( batch, [&, i]()
+		{
+			auto & s = states[ i ];
+			s.data = evaluate( s.data.data(), s.done );
+			{
+				std::lock_guard< std::mutex > guard( ready_lock );
+				ready.push_back( i );
+			}
+			eventfd_write( efd, 1 );
+		} );
+	};
+
+	auto start = [&]( size_type i )
+	{
+		auto & s = states[ i ];
+		++active;
+
+		s.in = ::open( jobs[ i ].input.c_str(), O_RDONLY | O_CLOEXEC );
+		struct stat st;
+		if ( s.in < 0 or fstat( s.in, &st ) != 0 )
+		{
+			s.error = describe( jobs[ i ].input, errno );
+			finish( i );
+			return;
+		}
+
+		// Pipes, dispositivos e arquivos do /proc informam tamanho 0: são
+		// lidos em blocos, com o buffer crescendo, até uma leitura vazia
+		s.grow = not S_ISREG( st.st_mode ) or st.st_size == 0;
+		s.data.resize( s.grow ? CHUNK : st.st_size );
+		s.done = 0;
+
+		queue_read( i );
+	};
+
+	arm_event();
+
+	while ( finished < jobs.size() )
+	{
+		while ( active < WINDOW and next < jobs.size() )
+		{
+			start( next++ );
+		}
+		if ( finished == jobs.size() )
+		{
+			break;
+		}
+
+		auto err = ring.submit( 1 );
+		if ( err == -EAGAIN or err == -EBUSY )
+		{
+			// Fila de conclusão cheia no kernel: tenta de novo depois de
+			// consumir o que já concluiu
+			std::this_thread::yield();
+		}
+		else if ( err < 0 )
+		{
+			// O anel deixou de funcionar: depois que as avaliações em
+			// andamento terminam, o que faltou segue síncrono
+			pool.wait( batch );
+
+			std::vector< Job > rest;
+			std::vector< size_type > where;
+			for ( size_type i = 0; i < jobs.size(); ++i )
+			{
+				if ( not states[ i ].finished )
+				{
+					// Os buffers ficam vivos: o kernel ainda pode ter
+					// requisições deles em andamento
+					if ( states[ i ].in >= 0 )
+					{
+						::close( states[ i ].in );
+					}
+					if ( states[ i ].out >= 0 )
+					{
+						::close( states[ i ].out );
+					}
+					rest.push_back( jobs[ i ] );
+					where.push_back( i );
+				}
+			}
+
+			std::vector< State > rest_states( rest.size() );
+			run_sync( rest, rest_states );
+			for ( size_type k = 0; k < rest.size(); ++k )
+			{
+				states[ where[ k ] ].error = rest_states[ k ].error;
+			}
+
+			::close( efd );
+			return;
+		}
+
+		std::uint64_t tag;
+		int res;
+
+		while ( ring.pop( tag, res ) )
+		{
+			if ( tag == EVENT_TAG )
+			{
+				std::vector< size_type > done;
+				{
+					std::lock_guard< std::mutex > guard( ready_lock );
+					done.swap( ready );
+				}
+
+				for ( auto i : done )
+				{
+					auto & s = states[ i ];
+					s.done = 0;
+					s.out = open_output( jobs[ i ].output );
+
+					if ( s.out < 0 )
+					{
+						s.error = describe( jobs[ i ].output, errno );
+						finish( i );
+					}
+					else if ( s.data.empty() )
+					{
+						finish( i );
+					}
+					else
+					{
+						queue_write( i );
+					}
+				}
+
+				arm_event();
+				continue;
+			}
+
+			auto i = static_cast< size_type >( tag );
+			auto & s = states[ i ];
+
+			if ( res < 0 )
+			{
+				s.error = describe( s.out >= 0 ? jobs[ i ].output : jobs[ i ].input, -res );
+				finish( i );
+				continue;
+			}
+
+			if ( s.out < 0 )
+			{
+				// Leitura: o arquivo pode ter diminuído desde o fstat
+				s.done += res;
+				if ( res == 0 )
+				{
+					s.data.resize( s.done );
+				}
+				else if ( s.grow and s.done == s.data.size() )
+				{
+					s.data.resize( 2 * s.data.size() );
+				}
+
+				if ( s.done < s.data.size() )
+				{
+					queue_read( i );
+				}
+				else
+				{
+					::close( s.in );
+					s.in = -1;
+					dispatch( i );
+				}
+			}
+			else
+			{
+				// Escrita: escritas parciais continuam de onde pararam
+				s.done += res;
+				if ( res == 0 )
+				{
+					s.error = describe( jobs[ i ].output, EIO );
+					finish( i );
+				}
+				else if ( s.done < s.data.size() )
+				{
+					queue_write( i );
+				}
+				else
+				{
+					finish( i );
+				}
+			}
+		}
+	}
+
+	// Nenhuma tarefa pode mais tocar no eventfd, e a leitura pendente dele
+	// é concluída antes de fechá-lo
+	pool.wait( batch );
+	eventfd_write( efd, 1 );
+
+	std::uint64_t tag = 0;
+	int res;
+	while ( tag != EVENT_TAG and ring.submit( 1 ) == 0 )
+	{
+		while ( tag != EVENT_TAG and ring.pop( tag, res ) )
+		{
+		}
+	}
+
+	::close( efd );
+}
@@ -0,0 +1,256 @@
+/**
+ * @file file_follower.cpp
+ * @brief      Implementação dos métodos da classe FileFollower
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno, EINTR
+#include <cstring>  	// std::strerror, std::memchr
+
+#include <fcntl.h>  	// open
+#include <sys/inotify.h>	// inotify_init1, inotify_add_watch
+#include <sys/stat.h>	// fstat, stat
+#include <unistd.h> 	// read, lseek, close
+
+#include "file_follower.hpp"
+
+namespace
+{
+	constexpr std::uint32_t FILE_EVENTS = IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF;
+	constexpr std::uint32_t DIR_EVENTS = IN_CREATE | IN_MOVED_TO;
+}
+
+/**
+ * @brief      Construtor do FileFollower
+ *
+ * @param[in]  path_  Caminho do arquivo
+ */
+FileFollower::FileFollower( const std::string & path_ )
+	: path( path_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Destrutor, fecha os descritores
+ */
+FileFollower::~FileFollower()
+{
+	if ( fd >= 0 )
+	{
+		::close( fd );
+	}
+	if ( notify >= 0 )
+	{
+		::close( notify );
+	}
+}
+
+/**
+ * @brief      Abre o arquivo do caminho e passa a observá-lo
+ *
+ * @return     Vazio se abriu, ou a descrição do erro
+ */
+std::string FileFollower::open_file( void )
+{
+	int next = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+	if ( next < 0 )
+	{
+		return "cannot open " + path + ": " + std::strerror( errno );
+	}
+
+	struct stat st;
+	fstat( next, &st );
+
+	if ( fd >= 0 )
+	{
+		::close( fd );
+	}
+	if ( file_watch >= 0 )
+	{
+		inotify_rm_watch( notify, file_watch );
+	}
+
+	fd = next;
+	device = st.st_dev;
+	inode = st.st_ino;
+	offset = 0;
+	partial.clear();
+
+	// Observado pelo caminho, logo depois de abrir: no pior caso um evento
+	// do arquivo antigo acorda a espera à toa
+	file_watch = inotify_add_watch( notify, path.c_str(), FILE_EVENTS );
+
+	return "";
+}
+
+/**
+ * @brief      Abre o arquivo e o inotify
+ *
+ * @param[in]  from_start  Ler o conteúdo atual
+ *
+ * @return     Vazio se abriu, ou a descrição do erro
+ */
+std::string FileFollower::start( bool from_start )
+{
+	notify = inotify_init1( IN_CLOEXEC );
+	if ( notify < 0 )
+	{
+		return std::string( "inotify unavailable: " ) + std::strerror( errno );
+	}
+
+	auto slash = path.rfind( '/' );
+	auto dir = slash == std::string::npos ? std::string( "." ) : path.substr( 0, slash + 1 );
+	dir_watch = inotify_add_watch( notify, dir.c_str(), DIR_EVENTS );
+
+	auto error = open_file();
+	if ( not error.empty() )
+	{
+		return error;
+	}
+
+	if ( not from_start )
+	{
+		auto end = lseek( fd, 0, SEEK_END );
+		offset = end < 0 ? 0 : end;
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Lê tudo o que existe depois da posição atual
+ *
+ * @param      lines  Onde acrescentar as linhas completas
+ *
+ * @return     Vazio se leu, ou a descrição do erro
+ */
+std::string FileFollower::drain( std::vector< std::string > & lines )
+{
+	struct stat st;
+	if ( fstat( fd, &st ) == 0 and static_cast< std::uint64_t >( st.st_size ) < offset )
+	{
+		// Truncado no lugar: o conteúdo atual é todo novo
+		lseek( fd, 0, SEEK_SET );
+		offset = 0;
+		partial.clear();
+	}
+
+	char block[ 1 << 16 ];
+
+	while ( true )
+	{
+		auto n = ::read( fd, block, sizeof( block ) );
+		if ( n < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( n < 0 )
+		{
+			return "cannot read " + path + ": " + std::strerror( errno );
+		}
+		if ( n == 0 )
+		{
+			return "";
+		}
+
+		offset += n;
+
+		const char * p = block;
+		const char * end = block + n;
+		while ( p < end )
+		{
+			auto nl = static_cast< const char * >( std::memchr( p, '\n', end - p ) );
+			if ( nl == nullptr )
+			{
+				partial.append( p, end - p );
+				break;
+			}
+
+			partial.append( p, nl - p );
+			lines.push_back( std::move( partial ) );
+			partial.clear();
+			p = nl + 1;
+		}
+	}
+}
+
+/**
+ * @brief      Troca de arquivo se outro tomou o lugar do caminho
+ *
+ * @param      lines  Onde acrescentar a última linha do arquivo antigo, se
+ *                    ela não terminou com '\n'
+ *
+ * @return     True se trocou
+ */
+bool FileFollower::rotated( std::vector< std::string > & lines )
+{
+	struct stat st;
+	if ( stat( path.c_str(), &st ) != 0 or ( st.st_dev == device and st.st_ino == inode ) )
+	{
+		return false;
+	}
+
+	// O que foi escrito no antigo até a troca ainda é lido
+	drain( lines );
+
+	auto last = partial;
+	if ( not open_file().empty() )
+	{
+		return false;
+	}
+
+	if ( not last.empty() )
+	{
+		lines.push_back( last );
+	}
+
+	return true;
+}
+
+/**
+ * @brief      Espera até haver ao menos uma linha nova completa
+ *
+ * @param[out] lines  As linhas novas
+ *
+ * @return     Vazio se leu, ou a descrição do erro
+ */
+std::string FileFollower::wait( std::vector< std::string > & lines )
+{
+	lines.clear();
+
+	// Eventos servem apenas para acordar: o estado do arquivo é conferido
+	// sempre, então eventos perdidos ou agrupados não fazem diferença
+	alignas( inotify_event ) char events[ 4096 ];
+
+	while ( true )
+	{
+		auto error = drain( lines );
+		if ( not error.empty() )
+		{
+			return error;
+		}
+
+		// O arquivo antigo já foi lido até o fim; o novo começa do início
+		if ( rotated( lines ) )
+		{
+			error = drain( lines );
+			if ( not error.empty() )
+			{
+				return error;
+			}
+		}
+
+		if ( not lines.empty() )
+		{
+			return "";
+		}
+
+		auto n = ::read( notify, events, sizeof( events ) );
+		if ( n < 0 and errno != EINTR )
+		{
+			return std::string( "inotify read failed: " ) + std::strerror( errno );
+		}
+	}
+}
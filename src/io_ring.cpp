@@ -0,0 +1,312 @@
+/**
+ * @file io_ring.cpp
+ * @brief      Implementação dos métodos da classe IoRing
+ * @details    Mapeia os anéis do io_uring e manipula as cabeças e caudas com
+ *             barreiras de aquisição e liberação, como descrito em
+ *             io_uring(7).
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno
+#include <cstring>  	// std::memset
+
+#if defined( __linux__ ) and defined( __has_include )
+#if __has_include( <linux/io_uring.h> )
+#include <linux/io_uring.h>	// io_uring_params, io_uring_sqe, io_uring_cqe
+#include <sys/mman.h>      	// mmap, munmap
+#include <sys/syscall.h>   	// SYS_io_uring_setup, SYS_io_uring_enter
+#include <unistd.h>        	// syscall, close
+#if defined( SYS_io_uring_setup ) and defined( SYS_io_uring_enter )
+#define BARES_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+#include "io_ring.hpp"
+
+#if defined( BARES_HAS_IO_URING )
+
+/**
+ * @brief      Cria um io_uring com o número de entradas informado
+ *
+ * @param[in]  entries  Tamanho da fila de submissão
+ */
+IoRing::IoRing( unsigned entries )
+{
+	io_uring_params p;
+	std::memset( &p, 0, sizeof( p ) );
+
+	fd = static_cast< int >( syscall( SYS_io_uring_setup, entries, &p ) );
+	if ( fd < 0 )
+	{
+		fd = -1;
+		return;
+	}
+
+	sq_ring_size = p.sq_off.array + p.sq_entries * sizeof( std::uint32_t );
+	cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof( io_uring_cqe );
+	sqes_size = p.sq_entries * sizeof( io_uring_sqe );
+
+	// Com IORING_FEAT_SINGLE_MMAP os dois anéis dividem o mesmo mapeamento
+	bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+	if ( single and cq_ring_size > sq_ring_size )
+	{
+		sq_ring_size = cq_ring_size;
+	}
+
+	sq_ring = mmap( nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING );
+	if ( sq_ring == MAP_FAILED )
+	{
+		sq_ring = nullptr;
+		close();
+		return;
+	}
+
+	if ( single )
+	{
+		cq_ring = sq_ring;
+	}
+	else
+	{
+		cq_ring = mmap( nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING );
+		if ( cq_ring == MAP_FAILED )
+		{
+			cq_ring = nullptr;
+			close();
+			return;
+		}
+	}
+
+	sqes = mmap( nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES );
+	if ( sqes == MAP_FAILED )
+	{
+		sqes = nullptr;
+		close();
+		return;
+	}
+
+	auto sq = static_cast< unsigned char * >( sq_ring );
+	sq_head = reinterpret_cast< std::uint32_t * >( sq + p.sq_off.head );
+	sq_tail = reinterpret_cast< std::uint32_t * >( sq + p.sq_off.tail );
+	sq_mask = reinterpret_cast< std::uint32_t * >( sq + p.sq_off.ring_mask );
+	sq_array = reinterpret_cast< std::uint32_t * >( sq + p.sq_off.array );
+	sq_entries = p.sq_entries;
+
+	auto cq = static_cast< unsigned char * >( cq_ring );
+	cq_head = reinterpret_cast< std::uint32_t * >( cq + p.cq_off.head );
+	cq_tail = reinterpret_cast< std::uint32_t * >( cq + p.cq_off.tail );
+	cq_mask = reinterpret_cast< std::uint32_t * >( cq + p.cq_off.ring_mask );
+	cqes = cq + p.cq_off.cqes;
+}
+
+/**
+ * @brief      Libera os mapeamentos e o descritor
+ */
+void IoRing::close( void )
+{
+	if ( sqes != nullptr )
+	{
+		munmap( sqes, sqes_size );
+	}
+	if ( cq_ring != nullptr and cq_ring != sq_ring )
+	{
+		munmap( cq_ring, cq_ring_size );
+	}
+	if ( sq_ring != nullptr )
+	{
+		munmap( sq_ring, sq_ring_size );
+	}
+	if ( fd >= 0 )
+	{
+		::close( fd );
+	}
+
+	sqes = cq_ring = sq_ring = nullptr;
+	fd = -1;
+}
+
+/**
+ * @brief      Prepara uma entrada de leitura ou escrita
+ *
+ * @return     False se a fila de submissão está cheia
+ */
+bool IoRing::prepare( unsigned char opcode, int file, const void * buf, std::uint32_t len,
+	std::uint64_t offset, std::uint64_t tag )
+{
+	if ( fd < 0 )
+	{
+		return false;
+	}
+
+	// Só esta thread escreve a cauda; a cabeça é avançada pelo kernel
+	auto tail = *sq_tail;
+	auto head = __atomic_load_n( sq_head, __ATOMIC_ACQUIRE );
+	if ( tail - head >= sq_entries )
+	{
+		return false;
+	}
+
+	auto index = tail & *sq_mask;
+	auto & sqe = static_cast< io_uring_sqe * >( sqes )[ index ];
+
+	std::memset( &sqe, 0, sizeof( sqe ) );
+	sqe.opcode = opcode;
+	sqe.fd = file;
+	sqe.off = offset;
+	sqe.addr = reinterpret_cast< std::uint64_t >( buf );
+	sqe.len = len;
+	sqe.user_data = tag;
+
+	sq_array[ index ] = index;
+	__atomic_store_n( sq_tail, tail + 1, __ATOMIC_RELEASE );
+
+	++to_submit;
+	return true;
+}
+
+/**
+ * @brief      Envia as entradas preparadas e espera ao menos wait_nr conclusões
+ *
+ * @param[in]  wait_nr  Quantidade mínima de conclusões
+ *
+ * @return     0, ou -errno se io_uring_enter falhou
+ */
+int IoRing::submit( unsigned wait_nr )
+{
+	if ( fd < 0 )
+	{
+		return -EBADF;
+	}
+
+	while ( to_submit > 0 or wait_nr > 0 )
+	{
+		auto r = syscall( SYS_io_uring_enter, fd, to_submit, wait_nr, wait_nr > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0 );
+		if ( r < 0 )
+		{
+			if ( errno == EINTR )
+			{
+				continue;
+			}
+			return -errno;
+		}
+
+		in_flight += r;
+		to_submit -= static_cast< std::uint32_t >( r );
+		break;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief      Retira a próxima conclusão, se houver
+ *
+ * @param[out] tag   Etiqueta da requisição
+ * @param[out] res   Resultado ( bytes transferidos ou -errno )
+ *
+ * @return     False se não há conclusões disponíveis
+ */
+bool IoRing::pop( std::uint64_t & tag, int & res )
+{
+	if ( fd < 0 )
+	{
+		return false;
+	}
+
+	auto head = *cq_head;
+	if ( head == __atomic_load_n( cq_tail, __ATOMIC_ACQUIRE ) )
+	{
+		return false;
+	}
+
+	const auto & cqe = static_cast< io_uring_cqe * >( cqes )[ head & *cq_mask ];
+	tag = cqe.user_data;
+	res = cqe.res;
+
+	__atomic_store_n( cq_head, head + 1, __ATOMIC_RELEASE );
+
+	--in_flight;
+	return true;
+}
+
+/**
+ * @brief      Enfileira uma leitura de len bytes a partir de offset
+ */
+bool IoRing::read( int file, void * buf, std::uint32_t len, std::uint64_t offset, std::uint64_t tag )
+{
+	return prepare( IORING_OP_READ, file, buf, len, offset, tag );
+}
+
+/**
+ * @brief      Enfileira uma escrita de len bytes a partir de offset
+ */
+bool IoRing::write( int file, const void * buf, std::uint32_t len, std::uint64_t offset, std::uint64_t tag )
+{
+	return prepare( IORING_OP_WRITE, file, buf, len, offset, tag );
+}
+
+#else
+
+// Sem io_uring: o anel nunca fica disponível e quem usa faz E/S síncrona
+
+IoRing::IoRing( unsigned ) { /* Vazio */ }
+
+void IoRing::close( void ) { /* Vazio */ }
+
+bool IoRing::prepare( unsigned char, int, const void *, std::uint32_t, std::uint64_t, std::uint64_t )
+{
+	return false;
+}
+
+int IoRing::submit( unsigned )
+{
+	return -ENOSYS;
+}
+
+bool IoRing::pop( std::uint64_t &, int & )
+{
+	return false;
+}
+
+bool IoRing::read( int, void *, std::uint32_t, std::uint64_t, std::uint64_t )
+{
+	return false;
+}
+
+bool IoRing::write( int, const void *, std::uint32_t, std::uint64_t, std::uint64_t )
+{
+	return false;
+}
+
+#endif
+
+/**
+ * @brief      Destrutor do IoRing
+ */
+IoRing::~IoRing()
+{
+	close();
+}
+
+/**
+ * @brief      Informa se o io_uring foi criado
+ *
+ * @return     True se pode ser usado, False caso contrário
+ */
+bool IoRing::is_available( void ) const
+{
+	return fd >= 0;
+}
+
+/**
+ * @brief      Informa quantas requisições foram enviadas e ainda não concluíram
+ *
+ * @return     Requisições em andamento
+ */
+IoRing::size_type IoRing::pending( void ) const
+{
+	return in_flight;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file jit.cpp
+ * @brief      Implementação dos métodos da classe JitExpression
+ * @details    Gera código x86-64 ( System V ) para uma Program. O código usa a
+ *             pilha nativa como pilha de avaliação, r12 aponta para os slots,
+ *             r13 para a saída e r14d guarda o código do último operador,
+ *             reproduzindo a semântica de Evaluator::evaluate_postfix.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstring>  	// std::memcpy
+#include <cstdint>  	// std::int32_t, std::uint64_t
+#include <limits>   	// std::numeric_limits
+#include <vector>   	// std::vector
+#include <initializer_list>	// std::initializer_list
+
+#include "jit.hpp"
+#include "parser.hpp"	// Parser::required_int_type
+
+#ifdef BARES_JIT_NATIVE
+#include <sys/mman.h>	// mmap, mprotect, munmap
+#endif
+
+namespace
+{
+	/**
+	 * @brief      Buffer com os bytes do código sendo gerado
+	 */
+	class Assembler
+	{
+		public:
+
+			std::vector< unsigned char > bytes;
+
+			void emit( std::initializer_list< unsigned char > b )
+			{
+				bytes.insert( bytes.end(), b );
+			}
+
+			void emit32( std::int32_t v )
+			{
+				unsigned char b[4];
+				std::memcpy( b, &v, 4 );
+				bytes.insert( bytes.end(), b, b + 4 );
+			}
+
+			void emit64( std::uint64_t v )
+			{
+				unsigned char b[8];
+				std::memcpy( b, &v, 8 );
+				bytes.insert( bytes.end(), b, b + 8 );
+			}
+
+			/**
+			 * @brief      Emite o opcode de um salto rel32 e reserva o
+			 *             deslocamento
+			 *
+			 * @return     A posição do deslocamento, para ser corrigida depois
+			 */
+			std::size_t jump( std::initializer_list< unsigned char > opcode )
+			{
+				emit( opcode );
+				emit32( 0 );
+				return bytes.size() - 4;
+			}
+
+			/**
+			 * @brief      Faz o salto reservado em `at` apontar para a posição
+			 *             atual
+			 */
+			void bind( std::size_t at )
+			{
+				std::int32_t rel = static_cast< std::int32_t >( bytes.size() - ( at + 4 ) );
+				std::memcpy( &bytes[ at ], &rel, 4 );
+			}
+	};
+}
+
+/**
+ * @brief      Compila o programa informado
+ *
+ * @param[in]  prog  O programa a ser compilado
+ */
+JitExpression::JitExpression( const Program & prog )
+	: program( prog )
+{
+	emit();
+}
+
+/**
+ * @brief      Destrutor, libera as páginas executáveis
+ */
+JitExpression::~JitExpression()
+{
+#ifdef BARES_JIT_NATIVE
+	if ( code != nullptr )
+	{
+		munmap( code, code_size );
+	}
+#endif
+}
+
+/**
+ * @brief      Gera o código nativo para o programa atual
+ *
+ * @return     True se o código foi gerado, False caso contrário
+ */
+bool JitExpression::emit( void )
+{
+#ifdef BARES_JIT_NATIVE
+	// Expressões muito profundas usariam demais a pilha nativa
+	constexpr Program::size_type MAX_NATIVE_DEPTH = 1 << 16;
+
+	if ( program.instructions().empty() or program.max_depth() > MAX_NATIVE_DEPTH )
+	{
+		return false;
+	}
+
+	const std::int32_t max = std::numeric_limits< Parser::required_int_type >::max();
+	const std::int32_t min = std::numeric_limits< Parser::required_int_type >::min();
+
+	Assembler a;
+
+	// Prólogo: salva os registradores callee-saved usados
+	a.emit( { 0x55 } );                    // push rbp
+	a.emit( { 0x48, 0x89, 0xe5 } );        // mov rbp, rsp
+	a.emit( { 0x53 } );                    // push rbx
+	a.emit( { 0x41, 0x54 } );              // push r12
+	a.emit( { 0x41, 0x55 } );              // push r13
+	a.emit( { 0x41, 0x56 } );              // push r14
+	a.emit( { 0x49, 0x89, 0xfc } );        // mov r12, rdi
+	a.emit( { 0x49, 0x89, 0xf5 } );        // mov r13, rsi
+	a.emit( { 0x45, 0x31, 0xf6 } );        // xor r14d, r14d
+
+	for ( const auto & ins : program.instructions() )
+	{
+		if ( ins.op == Program::Instruction::PUSH )
+		{
+			a.emit( { 0x49, 0x8b, 0x84, 0x24 } );  // mov rax, [r12 + disp32]
+			a.emit32( static_cast< std::int32_t >( ins.slot * sizeof( value_type ) ) );
+			a.emit( { 0x50 } );                    // push rax
+			continue;
+		}
+
+		a.emit( { 0x59 } );                        // pop rcx ( term2 )
+		a.emit( { 0x58 } );                        // pop rax ( term1 )
+
+		std::size_t to_dbz = 0;
+		bool unchecked = ins.op & Program::Instruction::UNCHECKED;
+		auto op = static_cast< Program::Instruction::opcode_t >( ins.op & ~Program::Instruction::UNCHECKED );
+		const bares::Operator & entry = Program::operator_of( op );
+
+		if ( entry.checks_divisor and not unchecked )
+		{
+			a.emit( { 0x48, 0x85, 0xc9 } );        // test rcx, rcx
+			to_dbz = a.jump( { 0x0f, 0x84 } );     // jz dbz
+		}
+
+		switch ( op )
+		{
+			case Program::Instruction::ADD:
+				a.emit( { 0x48, 0x01, 0xc8 } );        // add rax, rcx
+				break;
+			case Program::Instruction::SUB:
+				a.emit( { 0x48, 0x29, 0xc8 } );        // sub rax, rcx
+				break;
+			case Program::Instruction::MUL:
+				a.emit( { 0x48, 0x0f, 0xaf, 0xc1 } );  // imul rax, rcx
+				break;
+			case Program::Instruction::DIV:
+			case Program::Instruction::MOD:
+				a.emit( { 0x48, 0x99 } );              // cqo
+				a.emit( { 0x48, 0xf7, 0xf9 } );        // idiv rcx
+				if ( op == Program::Instruction::MOD )
+				{
+					a.emit( { 0x48, 0x89, 0xd0 } );    // mov rax, rdx
+				}
+				break;
+			default:
+				// Demais operadores ( "^" ): chama a função da tabela
+				a.emit( { 0x48, 0x89, 0xc7 } );        // mov rdi, rax
+				a.emit( { 0x48, 0x89, 0xce } );        // mov rsi, rcx
+				a.emit( { 0x48, 0x89, 0xe3 } );        // mov rbx, rsp
+				a.emit( { 0x48, 0x83, 0xe4, 0xf0 } );  // and rsp, -16
+				a.emit( { 0x48, 0xb8 } );              // mov rax, imm64
+				a.emit64( reinterpret_cast< std::uint64_t >( entry.kernel ) );
+				a.emit( { 0xff, 0xd0 } );              // call rax
+				a.emit( { 0x48, 0x89, 0xdc } );        // mov rsp, rbx
+				break;
+		}
+
+		// Operação provada segura pela RangeAnalysis: sem testes
+		if ( unchecked )
+		{
+			a.emit( { 0x45, 0x31, 0xf6 } );        // xor r14d, r14d
+			a.emit( { 0x50 } );                    // push rax
+			continue;
+		}
+
+		// Teste de estouro contra Parser::required_int_type
+		a.emit( { 0x48, 0x3d } );                  // cmp rax, max
+		a.emit32( max );
+		auto to_ovf1 = a.jump( { 0x0f, 0x8f } );   // jg ovf
+		a.emit( { 0x48, 0x3d } );                  // cmp rax, min
+		a.emit32( min );
+		auto to_ovf2 = a.jump( { 0x0f, 0x8c } );   // jl ovf
+		a.emit( { 0x45, 0x31, 0xf6 } );            // xor r14d, r14d
+		auto to_next1 = a.jump( { 0xe9 } );        // jmp next
+
+		a.bind( to_ovf1 );
+		a.bind( to_ovf2 );
+		a.emit( { 0x31, 0xc0 } );                          // xor eax, eax
+		a.emit( { 0x41, 0xbe } );                          // mov r14d, NUMERIC_OVERFLOW
+		a.emit32( Evaluator::EvaluatorResult::NUMERIC_OVERFLOW );
+
+		std::size_t to_next2 = 0;
+		if ( to_dbz != 0 )
+		{
+			to_next2 = a.jump( { 0xe9 } );                 // jmp next
+			a.bind( to_dbz );
+			a.emit( { 0x31, 0xc0 } );                      // xor eax, eax
+			a.emit( { 0x41, 0xbe } );                      // mov r14d, DIVISION_BY_ZERO
+			a.emit32( Evaluator::EvaluatorResult::DIVISION_BY_ZERO );
+		}
+
+		a.bind( to_next1 );
+		if ( to_next2 != 0 )
+		{
+			a.bind( to_next2 );
+		}
+		a.emit( { 0x50 } );                                // push rax
+	}
+
+	// Epílogo: grava o valor e devolve o código
+	a.emit( { 0x58 } );                    // pop rax
+	a.emit( { 0x49, 0x89, 0x45, 0x00 } );  // mov [r13], rax
+	a.emit( { 0x44, 0x89, 0xf0 } );        // mov eax, r14d
+	a.emit( { 0x41, 0x5e } );              // pop r14
+	a.emit( { 0x41, 0x5d } );              // pop r13
+	a.emit( { 0x41, 0x5c } );              // pop r12
+	a.emit( { 0x5b } );                    // pop rbx
+	a.emit( { 0x5d } );                    // pop rbp
+	a.emit( { 0xc3 } );                    // ret
+
+	code_size = a.bytes.size();
+	code = mmap( nullptr, code_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+	if ( code == MAP_FAILED )
+	{
+		code = nullptr;
+		return false;
+	}
+
+	std::memcpy( code, a.bytes.data(), code_size );
+
+	if ( mprotect( code, code_size, PROT_READ | PROT_EXEC ) != 0 )
+	{
+		munmap( code, code_size );
+		code = nullptr;
+		return false;
+	}
+
+	entry = reinterpret_cast< entry_t >( code );
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief      Informa se a expressão está sendo executada como código nativo
+ *
+ * @return     True se há código nativo, False se o interpretador é usado
+ */
+bool JitExpression::is_native( void ) const
+{
+	return entry != nullptr;
+}
+
+/**
+ * @brief      Executa a expressão com os literais originais
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult JitExpression::run( void ) const
+{
+	return run( program.slots().data() );
+}
+
+/**
+ * @brief      Executa a expressão com outros valores nos slots
+ *
+ * @param[in]  operands  Um valor por slot
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult JitExpression::run( const value_type * operands ) const
+{
+	if ( entry == nullptr )
+	{
+		return program.run( operands );
+	}
+
+	value_type value = 0;
+	auto type = entry( operands, &value );
+
+	return Evaluator::EvaluatorResult( value, static_cast< Evaluator::EvaluatorResult::code_t >( type ) );
+}
@@ -0,0 +1,320 @@
+/**
+ * @file output_writer.cpp
+ * @brief      Implementação dos métodos da classe OutputWriter
+ * @details    Formatação de inteiros e mensagens de erro em um buffer
+ *             reutilizado, descarregado com write(2).
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::max
+#include <cerrno>   	// errno, EINTR
+#include <cstring>  	// std::memcpy
+
+#include <unistd.h> 	// ::write
+
+#include "output_writer.hpp"
+
+constexpr OutputWriter::size_type OutputWriter::DEFAULT_CAPACITY;
+constexpr OutputWriter::size_type OutputWriter::MAX_INTEGER_CHARS;
+constexpr int OutputWriter::MEMORY;
+
+namespace
+{
+	/**
+	 * @brief      Pares de dígitos "00" a "99", para formatar dois por vez
+	 */
+	constexpr char DIGIT_PAIRS[] =
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899";
+
+	/**
+	 * @brief      Modelos das mensagens, tudo o que vem antes da coluna
+	 */
+	constexpr char UNEXPECTED_END[]  = "Unexpected end of input at column (";
+	constexpr char ILL_FORMED[]      = "Ill formed integer at column (";
+	constexpr char MISSING_TERM[]    = "Missing <term> at column (";
+	constexpr char EXTRANEOUS[]      = "Extraneous symbol after valid expression found at column (";
+	constexpr char OUT_OF_RANGE[]    = "Integer constant out of range beginning at column (";
+	constexpr char MISSING_CLOSING[] = "Missing closing \")\" at column (";
+	constexpr char COLUMN_SUFFIX[]   = ")!\n";
+
+	/**
+	 * @brief      Mensagens completas, sem coluna
+	 */
+	constexpr char PARSER_UNHANDLED[]    = ">>> Unhandled error found!\n";
+	constexpr char NUMERIC_OVERFLOW[]    = "Numeric overflow error!\n";
+	constexpr char DIVISION_BY_ZERO[]    = "Division by zero!\n";
+	constexpr char EVALUATOR_UNHANDLED[] = "Unhandled error found!\n";
+}
+
+/**
+ * @brief      Construtor do OutputWriter
+ *
+ * @param[in]  fd_        Descritor da saída
+ * @param[in]  capacity_  Tamanho do buffer
+ */
+OutputWriter::OutputWriter( int fd_, size_type capacity_ )
+	: fd( fd_ )
+	, buffer( capacity_ < 256 ? 256 : capacity_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Destrutor, descarrega o que restou no buffer
+ */
+OutputWriter::~OutputWriter()
+{
+	flush();
+}
+
+/**
+ * @brief      Garante espaço contíguo para n bytes
+ *
+ * @param[in]  n     Bytes necessários
+ *
+ * @return     Ponteiro para o espaço livre
+ */
+char * OutputWriter::reserve( size_type n )
+{
+	if ( used + n > buffer.size() )
+	{
+		if ( fd == MEMORY )
+		{
+			buffer.resize( std::max( buffer.size() * 2, used + n ) );
+		}
+		else
+		{
+			flush();
+		}
+	}
+
+	return buffer.data() + used;
+}
+
+/**
+ * @brief      Formata um inteiro em base 10
+ *
+ * @param      out    Destino, com espaço para MAX_INTEGER_CHARS
+ * @param[in]  value  O valor
+ *
+ * @return     Ponteiro para depois do último caractere escrito
+ */
+char * OutputWriter::format_integer( char * out, long long value )
+{
+	unsigned long long u = static_cast< unsigned long long >( value );
+
+	if ( value < 0 )
+	{
+		*out++ = '-';
+		u = 0ull - u;
+	}
+
+	// Escreve de trás para frente em um temporário e copia
+	char tmp[ MAX_INTEGER_CHARS ];
+	char * end = tmp + MAX_INTEGER_CHARS;
+	char * p = end;
+
+	while ( u >= 100 )
+	{
+		auto pair = ( u % 100 ) * 2;
+		u /= 100;
+		*--p = DIGIT_PAIRS[ pair + 1 ];
+		*--p = DIGIT_PAIRS[ pair ];
+	}
+	if ( u >= 10 )
+	{
+		*--p = DIGIT_PAIRS[ u * 2 + 1 ];
+		*--p = DIGIT_PAIRS[ u * 2 ];
+	}
+	else
+	{
+		*--p = static_cast< char >( '0' + u );
+	}
+
+	std::memcpy( out, p, end - p );
+	return out + ( end - p );
+}
+
+/**
+ * @brief      Escreve o valor de uma expressão seguido de '\n'
+ *
+ * @param[in]  value  O valor
+ */
+void OutputWriter::write_value( long long value )
+{
+	char * p = reserve( MAX_INTEGER_CHARS + 1 );
+	char * end = format_integer( p, value );
+	*end++ = '\n';
+	used += end - p;
+}
+
+/**
+ * @brief      Escreve um modelo com a coluna ( 1-based ) inserida
+ *
+ * @param[in]  prefix  Texto antes da coluna
+ * @param[in]  n       Tamanho do prefixo
+ * @param[in]  col     A coluna ( 0-based ) do erro
+ */
+void OutputWriter::write_with_column( const char * prefix, size_type n, long long col )
+{
+	char * p = reserve( n + MAX_INTEGER_CHARS + sizeof( COLUMN_SUFFIX ) );
+	char * end = p;
+
+	std::memcpy( end, prefix, n );
+	end = format_integer( end + n, col + 1 );
+	std::memcpy( end, COLUMN_SUFFIX, sizeof( COLUMN_SUFFIX ) - 1 );
+	end += sizeof( COLUMN_SUFFIX ) - 1;
+
+	used += end - p;
+}
+
+/**
+ * @brief      Escreve a mensagem de erro do Parser
+ *
+ * @param[in]  result  O resultado da avaliação do Parser
+ */
+void OutputWriter::write_parser_error( const Parser::ParserResult & result )
+{
+	switch ( result.type )
+	{
+		case Parser::ParserResult::UNEXPECTED_END_OF_EXPRESSION:
+			write_with_column( UNEXPECTED_END, sizeof( UNEXPECTED_END ) - 1, result.at_col );
+			break;
+		case Parser::ParserResult::ILL_FORMED_INTEGER:
+			write_with_column( ILL_FORMED, sizeof( ILL_FORMED ) - 1, result.at_col );
+			break;
+		case Parser::ParserResult::MISSING_TERM:
+			write_with_column( MISSING_TERM, sizeof( MISSING_TERM ) - 1, result.at_col );
+			break;
+		case Parser::ParserResult::EXTRANEOUS_SYMBOL:
+			write_with_column( EXTRANEOUS, sizeof( EXTRANEOUS ) - 1, result.at_col );
+			break;
+		case Parser::ParserResult::INTEGER_OUT_OF_RANGE:
+			write_with_column( OUT_OF_RANGE, sizeof( OUT_OF_RANGE ) - 1, result.at_col );
+			break;
+		case Parser::ParserResult::MISSING_CLOSING_PARENTHESIS:
+			write_with_column( MISSING_CLOSING, sizeof( MISSING_CLOSING ) - 1, result.at_col );
+			break;
+		default:
+			write( PARSER_UNHANDLED, sizeof( PARSER_UNHANDLED ) - 1 );
+			break;
+	}
+}
+
+/**
+ * @brief      Escreve a mensagem de erro do Evaluator
+ *
+ * @param[in]  result  O resultado da avaliação do Evaluator
+ */
+void OutputWriter::write_evaluator_error( const Evaluator::EvaluatorResult & result )
+{
+	switch ( result.type )
+	{
+		case Evaluator::EvaluatorResult::NUMERIC_OVERFLOW:
+			write( NUMERIC_OVERFLOW, sizeof( NUMERIC_OVERFLOW ) - 1 );
+			break;
+		case Evaluator::EvaluatorResult::DIVISION_BY_ZERO:
+			write( DIVISION_BY_ZERO, sizeof( DIVISION_BY_ZERO ) - 1 );
+			break;
+		default:
+			write( EVALUATOR_UNHANDLED, sizeof( EVALUATOR_UNHANDLED ) - 1 );
+			break;
+	}
+}
+
+/**
+ * @brief      Escreve bytes sem formatação
+ *
+ * @param[in]  data  Os bytes
+ * @param[in]  n     Quantidade de bytes
+ */
+void OutputWriter::write( const char * data, size_type n )
+{
+	if ( n >= buffer.size() and fd != MEMORY )
+	{
+		// Blocos grandes vão direto, sem passar pelo buffer
+		flush();
+		while ( n > 0 and not failed )
+		{
+			auto w = ::write( fd, data, n );
+			if ( w < 0 and errno == EINTR )
+			{
+				continue;
+			}
+			if ( w <= 0 )
+			{
+				failed = true;
+				break;
+			}
+			data += w;
+			n -= w;
+		}
+		return;
+	}
+
+	char * p = reserve( n );
+	std::memcpy( p, data, n );
+	used += n;
+}
+
+/**
+ * @brief      Descarrega o buffer com write(2)
+ *
+ * @return     True se todas as escritas até agora deram certo
+ */
+bool OutputWriter::flush( void )
+{
+	if ( fd == MEMORY )
+	{
+		return true;
+	}
+
+	size_type done = 0;
+
+	while ( done < used and not failed )
+	{
+		auto w = ::write( fd, buffer.data() + done, used - done );
+		if ( w < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( w <= 0 )
+		{
+			failed = true;
+			break;
+		}
+		done += w;
+	}
+
+	used = 0;
+	return not failed;
+}
+
+/**
+ * @brief      Entrega o que foi escrito em memória e recomeça vazio
+ *
+ * @return     Os bytes escritos desde o último release()
+ */
+std::vector< char > OutputWriter::release( void )
+{
+	auto capacity = buffer.size();
+
+	buffer.resize( used );
+	std::vector< char > out;
+	out.swap( buffer );
+
+	buffer.resize( capacity );
+	used = 0;
+
+	return out;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file parallel_evaluator.cpp
+ * @brief      Implementação dos métodos da classe ParallelEvaluator
+ * @details    Divide a árvore da expressão posfixa em subárvores
+ *             independentes, avaliadas em paralelo, e combina os resultados em
+ *             série.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::sort, std::min
+#include <string>   	// std::stol
+
+#include "parallel_evaluator.hpp"
+
+constexpr ParallelEvaluator::size_type ParallelEvaluator::DEFAULT_THRESHOLD;
+
+/**
+ * @brief      Construtor do ParallelEvaluator
+ *
+ * @param      pool_       Pool onde as tarefas são executadas
+ * @param[in]  threshold_  Tamanho máximo de uma subárvore avaliada por uma
+ *                         única tarefa
+ */
+ParallelEvaluator::ParallelEvaluator( ThreadPool & pool_, size_type threshold_ )
+	: pool( pool_ )
+	, threshold( threshold_ < 2 ? 2 : threshold_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Avalia o valor representado pela expressão posfixa
+ *
+ * @param[in]  postfix  Expressão a ser avaliada
+ *
+ * @return     O mesmo EvaluatorResult de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult ParallelEvaluator::evaluate_postfix( const std::vector< Token > & postfix ) const
+{
+	using code_t = Evaluator::EvaluatorResult::code_t;
+
+	auto n = postfix.size();
+
+	if ( n == 0 )
+	{
+		return Evaluator::EvaluatorResult();
+	}
+
+	std::vector< value_type > values( n, 0 );   // Valor de cada nó
+	std::vector< char > ops( n, 0 );            // Operador de cada nó, 0 para literais
+	std::vector< code_t > codes( n, code_t::RESULT_OK ); // Código do operador de cada nó
+	std::vector< size_type > sizes( n, 1 );     // Tamanho da subárvore de cada nó
+	ThreadPool::Group batch;                    // As tarefas desta chamada
+
+	// 1. Conversão dos literais, em blocos independentes
+	for ( size_type first = 0; first < n; first += threshold )
+	{
+		auto last = std::min( n, first + threshold );
+
+		pool.submit( batch, [&postfix, &values, &ops, first, last]()
+		{
+			for ( auto i = first; i < last; ++i )
+			{
+				if ( postfix[ i ].type == Token::token_t::OPERAND )
+				{
+					values[ i ] = std::stol( postfix[ i ].value );
+				}
+				else
+				{
+					ops[ i ] = postfix[ i ].value[0];
+				}
+			}
+		} );
+	}
+	pool.wait( batch );
+
+	// 2. Tamanho das subárvores: o filho direito de i é i-1 e o esquerdo vem
+	//    logo antes da subárvore direita
+	for ( size_type i = 0; i < n; ++i )
+	{
+		if ( ops[ i ] != 0 )
+		{
+			auto right = i - 1;
+			auto left = right - sizes[ right ];
+			sizes[ i ] = 1 + sizes[ right ] + sizes[ left ];
+		}
+	}
+
+	// 3. Separa as maiores subárvores com até `threshold` nós ( cortes ) dos
+	//    nós acima delas
+	std::vector< size_type > cuts;
+	std::vector< size_type > top;
+	std::vector< size_type > pending{ n - 1 };
+
+	while ( not pending.empty() )
+	{
+		auto i = pending.back();
+		pending.pop_back();
+
+		if ( sizes[ i ] <= threshold )
+		{
+			if ( ops[ i ] != 0 )
+			{
+				cuts.push_back( i );
+			}
+		}
+		else
+		{
+			top.push_back( i );
+			pending.push_back( i - 1 );
+			pending.push_back( i - 1 - sizes[ i - 1 ] );
+		}
+	}
+
+	// 4. Avalia os cortes em paralelo, agrupando os pequenos em uma só tarefa.
+	//    Cada corte escreve apenas no próprio nó, que nenhuma outra tarefa lê.
+	std::sort( cuts.begin(), cuts.end() );
+
+	auto eval_cuts = [&values, &ops, &codes, &sizes]( std::vector< size_type > group )
+	{
+		std::vector< value_type > st;
+
+		for ( auto root : group )
+		{
+			st.clear();
+			code_t code = code_t::RESULT_OK;
+
+			for ( auto j = root + 1 - sizes[ root ]; j <= root; ++j )
+			{
+				if ( ops[ j ] == 0 )
+				{
+					st.push_back( values[ j ] );
+				}
+				else
+				{
+					auto term2 = st.back(); st.pop_back();
+					auto term1 = st.back();
+
+					auto result = Evaluator::execute_operator( term1, term2, ops[ j ] );
+					st.back() = result.value;
+					code = result.type;
+				}
+			}
+
+			values[ root ] = st.back();
+			codes[ root ] = code;
+		}
+	};
+
+	std::vector< size_type > group;
+	size_type group_size = 0;
+
+	for ( auto root : cuts )
+	{
+		group.push_back( root );
+		group_size += sizes[ root ];
+
+		if ( group_size >= threshold )
+		{
+			pool.submit( batch, [eval_cuts, group]() { eval_cuts( group ); } );
+			group.clear();
+			group_size = 0;
+		}
+	}
+	if ( not group.empty() )
+	{
+		pool.submit( batch, [eval_cuts, group]() { eval_cuts( group ); } );
+	}
+	pool.wait( batch );
+
+	// 5. Combina os nós de cima em série, na ordem da posfixa ( filhos antes
+	//    dos pais ), assim o código final é o do último operador, como no
+	//    caminho serial
+	std::sort( top.begin(), top.end() );
+
+	for ( auto i : top )
+	{
+		auto right = i - 1;
+		auto left = right - sizes[ right ];
+
+		auto result = Evaluator::execute_operator( values[ left ], values[ right ], ops[ i ] );
+		values[ i ] = result.value;
+		codes[ i ] = result.type;
+	}
+
+	return Evaluator::EvaluatorResult( values[ n - 1 ], codes[ n - 1 ] );
+}
@@ -0,0 +1,420 @@
+/**
+ * @file parallel_parser.cpp
+ * @brief      Implementação dos métodos da classe ParallelParser
+ * @details    Separa os lexemas em blocos paralelos, costura os blocos com uma
+ *             soma de prefixos e verifica a gramática do Parser sobre os
+ *             lexemas.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::copy, std::max
+#include <limits>   	// std::numeric_limits
+#include <string>   	// std::stoll
+
+#include "parallel_parser.hpp"
+#include "operators.hpp"	// bares::is_operator
+
+constexpr ParallelParser::size_type ParallelParser::DEFAULT_CHUNK;
+
+namespace
+{
+	/**
+	 * @brief      Determina se o caractere é um dígito
+	 */
+	inline bool is_digit( char c )
+	{
+		return c >= '0' and c <= '9';
+	}
+}
+
+/**
+ * @brief      Construtor do ParallelParser
+ *
+ * @param      pool_   Pool onde os blocos são separados
+ * @param[in]  chunk_  Tamanho aproximado de cada bloco
+ */
+ParallelParser::ParallelParser( ThreadPool & pool_, size_type chunk_ )
+	: pool( pool_ )
+	, chunk_size( chunk_ == 0 ? 1 : chunk_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Separa os lexemas de [first, last)
+ *
+ * @param      out    Onde guardar os lexemas e as profundidades do bloco
+ * @param[in]  first  Início do bloco
+ * @param[in]  last   Fim do bloco ( nunca no meio de uma sequência de dígitos )
+ */
+void ParallelParser::lex( Chunk & out, size_type first, size_type last ) const
+{
+	long depth = 0;
+
+	for ( auto i = first; i < last; ++i )
+	{
+		char c = expr[ i ];
+
+		if ( c == ' ' or c == 9 )
+		{
+			continue;
+		}
+
+		if ( is_digit( c ) )
+		{
+			auto j = i;
+			while ( j < last and is_digit( expr[ j ] ) )
+			{
+				++j;
+			}
+
+			// Zeros à esquerda são lidos um a um pelo Parser
+			while ( i < j and expr[ i ] == '0' )
+			{
+				out.lexemes.push_back( Lexeme{ '0', static_cast< std::ptrdiff_t >( i ), 1 } );
+				++i;
+			}
+			if ( i < j )
+			{
+				out.lexemes.push_back( Lexeme{ 'n', static_cast< std::ptrdiff_t >( i ), static_cast< std::ptrdiff_t >( j - i ) } );
+			}
+
+			i = j - 1;
+			continue;
+		}
+
+		char kind = '?';
+
+		if ( bares::is_operator( c ) )
+		{
+			kind = c;
+		}
+		else if ( c == '(' )
+		{
+			kind = c;
+			out.max_depth = std::max( out.max_depth, ++depth );
+		}
+		else if ( c == ')' )
+		{
+			kind = c;
+			out.min_depth = std::min( out.min_depth, --depth );
+		}
+
+		out.lexemes.push_back( Lexeme{ kind, static_cast< std::ptrdiff_t >( i ), 1 } );
+	}
+
+	out.net = depth;
+}
+
+/**
+ * @brief      Tokeniza uma string, como Parser::parse
+ *
+ * @param[in]  e_    String a ser tokenizada
+ *
+ * @return     O mesmo resultado de Parser::parse
+ */
+ParallelParser::ParserResult ParallelParser::parse( std::string e_ )
+{
+	ThreadPool::Group batch;	// As tarefas desta chamada
+
+	expr = std::move( e_ );
+	lexemes.clear();
+	token_list.clear();
+	k = 0;
+	pos = 0;
+
+	auto n = expr.size();
+
+	// Blocos terminam apenas fora de sequências de dígitos
+	std::vector< size_type > bounds{ 0 };
+	for ( auto b = chunk_size; b < n; b += chunk_size )
+	{
+		auto c = std::max( b, bounds.back() + 1 );
+		while ( c < n and is_digit( expr[ c - 1 ] ) and is_digit( expr[ c ] ) )
+		{
+			++c;
+		}
+		if ( c >= n )
+		{
+			break;
+		}
+		bounds.push_back( c );
+		b = c;
+	}
+	bounds.push_back( n );
+
+	auto count = bounds.size() - 1;
+	std::vector< Chunk > chunks( count );
+
+	if ( count == 1 )
+	{
+		lex( chunks[0], 0, n );
+	}
+	else
+	{
+		for ( size_type c = 0; c < count; ++c )
+		{
+			pool.submit( batch, [this, &chunks, &bounds, c]() { lex( chunks[ c ], bounds[ c ], bounds[ c + 1 ] ); } );
+		}
+		pool.wait( batch );
+	}
+
+	// Soma de prefixos sobre os blocos: posição no vetor final e profundidade
+	// de parênteses no início de cada bloco
+	std::vector< size_type > offset( count + 1, 0 );
+	long depth_at = 0;
+	max_depth = 0;
+	balanced = true;
+
+	for ( size_type c = 0; c < count; ++c )
+	{
+		offset[ c + 1 ] = offset[ c ] + chunks[ c ].lexemes.size();
+
+		if ( depth_at + chunks[ c ].min_depth < 0 )
+		{
+			balanced = false;
+		}
+		max_depth = std::max( max_depth, depth_at + chunks[ c ].max_depth );
+		depth_at += chunks[ c ].net;
+	}
+	balanced = balanced and depth_at == 0;
+
+	lexemes.resize( offset[ count ] );
+
+	if ( count == 1 )
+	{
+		lexemes.swap( chunks[0].lexemes );
+	}
+	else
+	{
+		for ( size_type c = 0; c < count; ++c )
+		{
+			pool.submit( batch, [this, &chunks, &offset, c]()
+			{
+				std::copy( chunks[ c ].lexemes.begin(), chunks[ c ].lexemes.end(), lexemes.begin() + offset[ c ] );
+			} );
+		}
+		pool.wait( batch );
+	}
+
+	// Verificação da gramática, idêntica a Parser::parse
+	skip_ws();
+	if ( end_input() )
+	{
+		return ParserResult( ParserResult::code_t::UNEXPECTED_END_OF_EXPRESSION, pos );
+	}
+
+	auto result = expression();
+
+	if ( result.type == ParserResult::code_t::PARSER_OK )
+	{
+		skip_ws();
+		if ( not end_input() )
+		{
+			return ParserResult( ParserResult::code_t::EXTRANEOUS_SYMBOL, pos );
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief      Equivalente a Parser::skip_ws: todo caractere que não é espaço
+ *             pertence a um lexema
+ */
+void ParallelParser::skip_ws( void )
+{
+	pos = k < lexemes.size() ? lexemes[ k ].col : static_cast< std::ptrdiff_t >( expr.size() );
+}
+
+/**
+ * @brief      Equivalente a Parser::accept: o lexema precisa começar
+ *             exatamente na posição atual
+ */
+bool ParallelParser::accept( char kind )
+{
+	if ( k < lexemes.size() and lexemes[ k ].col == pos and lexemes[ k ].kind == kind )
+	{
+		pos = lexemes[ k ].col + lexemes[ k ].len;
+		++k;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief      Equivalente a Parser::expect
+ */
+bool ParallelParser::expect( char kind )
+{
+	skip_ws();
+	return accept( kind );
+}
+
+/**
+ * @brief      Equivalente a Parser::end_input
+ */
+bool ParallelParser::end_input( void ) const
+{
+	return pos >= static_cast< std::ptrdiff_t >( expr.size() );
+}
+
+/**
+ * @brief      Equivalente a Parser::integer
+ */
+ParallelParser::ParserResult ParallelParser::integer( void )
+{
+	auto begin_token = pos;
+
+	if ( accept( '0' ) )
+	{
+		token_list.emplace_back( Token( "0", Token::token_t::OPERAND, begin_token ) );
+		return ParserResult( ParserResult::code_t::PARSER_OK );
+	}
+
+	auto cont = 0;
+	while ( accept( '-' ) )
+	{
+		++cont;
+	}
+
+	auto number = k;
+
+	if ( accept( 'n' ) )
+	{
+		const auto & lx = lexemes[ number ];
+
+		std::string token_str = expr.substr( lx.col, lx.len );
+		if ( cont % 2 == 1 )
+		{
+			token_str = "-" + token_str;
+		}
+
+		// Mais de 5 dígitos já está fora da faixa ( e não cabe em stoll se
+		// for muito longo )
+		Parser::input_int_type token_int = lx.len > 5 ? std::numeric_limits< Parser::input_int_type >::max()
+		                                               : std::stoll( token_str );
+
+		if ( token_int >= std::numeric_limits< Parser::required_int_type >::max()
+			or token_int <= std::numeric_limits< Parser::required_int_type >::min() )
+		{
+			return ParserResult( ParserResult::code_t::INTEGER_OUT_OF_RANGE, begin_token );
+		}
+
+		token_list.emplace_back( Token( token_str, Token::token_t::OPERAND, begin_token ) );
+		return ParserResult( ParserResult::code_t::PARSER_OK, cont );
+	}
+	else if ( not end_input() )
+	{
+		return ParserResult( ParserResult::code_t::ILL_FORMED_INTEGER, begin_token );
+	}
+
+	return ParserResult( ParserResult::code_t::UNEXPECTED_END_OF_EXPRESSION, pos );
+}
+
+/**
+ * @brief      Verificação da gramática de Parser::expression e Parser::term,
+ *             sem recursão
+ */
+ParallelParser::ParserResult ParallelParser::expression( void )
+{
+	// Um item por expressão aberta: se ela já leu algum operador
+	std::vector< char > after_op;
+	after_op.reserve( max_depth + 1 );
+
+	skip_ws();
+	after_op.push_back( false );
+
+	ParserResult result;
+
+	while ( true )
+	{
+		// Parser::term
+		skip_ws();
+		auto scope_col = pos;
+
+		if ( expect( '(' ) )
+		{
+			token_list.emplace_back( Token( "(", Token::token_t::OPENING_SCOPE, scope_col ) );
+			skip_ws();
+			after_op.push_back( false );
+			continue;
+		}
+
+		result = integer();
+
+		// Continuação de Parser::expression após um termo; quando a expressão
+		// termina, volta para o Parser::term que abriu o parêntese
+		while ( true )
+		{
+			if ( after_op.back() and result.type != ParserResult::code_t::PARSER_OK
+				and result.type != ParserResult::code_t::INTEGER_OUT_OF_RANGE and end_input() )
+			{
+				result.type = ParserResult::code_t::MISSING_TERM;
+			}
+			else if ( result.type == ParserResult::code_t::PARSER_OK )
+			{
+				skip_ws();
+				auto op_col = pos;
+
+				if ( k < lexemes.size() and lexemes[ k ].col == pos and bares::is_operator( lexemes[ k ].kind ) )
+				{
+					token_list.emplace_back( Token( std::string( 1, lexemes[ k ].kind ), Token::token_t::OPERATOR, op_col ) );
+					accept( lexemes[ k ].kind );
+					after_op.back() = true;
+					break;
+				}
+			}
+
+			after_op.pop_back();
+			if ( after_op.empty() )
+			{
+				return result;
+			}
+
+			if ( result.type == ParserResult::code_t::PARSER_OK )
+			{
+				if ( not expect( ')' ) )
+				{
+					result = ParserResult( ParserResult::code_t::MISSING_CLOSING_PARENTHESIS, pos );
+				}
+				else
+				{
+					token_list.emplace_back( Token( ")", Token::token_t::CLOSING_SCOPE, pos - 1 ) );
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief      Recupera o vector com os tokens da string
+ *
+ * @return     Vector com os tokens
+ */
+std::vector< Token > ParallelParser::get_tokens( void ) const
+{
+	return token_list;
+}
+
+/**
+ * @brief      Informa a maior profundidade de parênteses encontrada
+ *
+ * @return     A maior profundidade
+ */
+long ParallelParser::depth( void ) const
+{
+	return max_depth;
+}
+
+/**
+ * @brief      Informa se os parênteses da última expressão estão balanceados
+ *
+ * @return     True se balanceados, False caso contrário
+ */
+bool ParallelParser::is_balanced( void ) const
+{
+	return balanced;
+}
@@ -16,6 +16,8 @@
  */
 
 #include "parser.hpp"
+#include "operators.hpp"
+#include "alloc_stats.hpp"
 
 /**
  * @brief      Função que tokeniza um string
@@ -38,6 +40,7 @@ Parser::ParserResult Parser::parse ( std::string e_ )
 	}
 
 	auto result = expression();
+	BARES_ALLOC_TOKENS( token_list.size() );
 
 	if ( result.type == ParserResult::code_t::PARSER_OK )
 	{
@@ -61,6 +64,42 @@ std::vector< Token > Parser::get_tokens ( void ) const
 	return token_list;
 }
 
+/**
+ * @brief      Monta a tabela de categorias
+ *
+ * @return     A tabela
+ */
+constexpr Parser::SymbolTable Parser::make_symbol_table( void )
+{
+	SymbolTable table{};
+
+	for ( std::size_t c = 0; c < 256; ++c )
+	{
+		table.symbol[ c ] = terminal_symbol_t::TS_INVALID;
+	}
+	for ( std::size_t i = 0; i < bares::OPERATOR_COUNT; ++i )
+	{
+		table.symbol[ static_cast< unsigned char >( bares::OPERATORS[ i ].symbol ) ] = terminal_symbol_t::TS_OPERATOR;
+	}
+	for ( char c = '1'; c <= '9'; ++c )
+	{
+		table.symbol[ static_cast< unsigned char >( c ) ] = terminal_symbol_t::TS_NON_ZERO_DIGIT;
+	}
+
+	// O "-" também é o sinal de um inteiro
+	table.symbol[ static_cast< unsigned char >( '-' ) ] = terminal_symbol_t::TS_MINUS;
+	table.symbol[ static_cast< unsigned char >( ')' ) ] = terminal_symbol_t::TS_CLOSING_SCOPE;
+	table.symbol[ static_cast< unsigned char >( '(' ) ] = terminal_symbol_t::TS_OPENING_SCOPE;
+	table.symbol[ static_cast< unsigned char >( ' ' ) ] = terminal_symbol_t::TS_WS;
+	table.symbol[ 9 ] = terminal_symbol_t::TS_TAB;
+	table.symbol[ static_cast< unsigned char >( '0' ) ] = terminal_symbol_t::TS_ZERO;
+	table.symbol[ 0 ] = terminal_symbol_t::TS_EOS;
+
+	return table;
+}
+
+const Parser::SymbolTable Parser::SYMBOLS = Parser::make_symbol_table();
+
 /**
  * @brief      Categoriza o símbolo ( char ) informado
  *
@@ -70,31 +109,7 @@ std::vector< Token > Parser::get_tokens ( void ) const
  */
 Parser::terminal_symbol_t Parser::lexer ( char c_ ) const
 {
-	switch( c_ )
-	{
-		case '+':  return terminal_symbol_t::TS_PLUS;
-		case '-':  return terminal_symbol_t::TS_MINUS;
-		case '%':  return terminal_symbol_t::TS_MOD;
-		case '/':  return terminal_symbol_t::TS_SLASH;
-		case '*':  return terminal_symbol_t::TS_ASTERISK;
-		case '^':  return terminal_symbol_t::TS_EXP;
-		case ')':  return terminal_symbol_t::TS_CLOSING_SCOPE;
-		case '(':  return terminal_symbol_t::TS_OPENING_SCOPE;
-		case ' ':  return terminal_symbol_t::TS_WS;
-		case   9:  return terminal_symbol_t::TS_TAB;
-		case '0':  return terminal_symbol_t::TS_ZERO;
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':  return terminal_symbol_t::TS_NON_ZERO_DIGIT;
-		case '\0': return terminal_symbol_t::TS_EOS;
-	}
-	return terminal_symbol_t::TS_INVALID;
+	return SYMBOLS.symbol[ static_cast< unsigned char >( c_ ) ];
 }
 
 /**
@@ -184,35 +199,18 @@ Parser::ParserResult Parser::expression ()
 
 	while ( result.type == ParserResult::code_t::PARSER_OK )
 	{
-		if ( expect( terminal_symbol_t::TS_PLUS) )
-		{
-			token_list.emplace_back( Token( "+", Token::token_t::OPERATOR) );
-		}
-		else if ( expect( terminal_symbol_t::TS_MINUS) )
-		{
-			token_list.emplace_back( Token( "-", Token::token_t::OPERATOR) );   
-		}
-		else if ( expect( terminal_symbol_t::TS_ASTERISK) )
-		{
-			token_list.emplace_back( Token( "*", Token::token_t::OPERATOR) );
-		}
-		else if ( expect( terminal_symbol_t::TS_SLASH) )
-		{
-			token_list.emplace_back( Token( "/", Token::token_t::OPERATOR) );
-		}
-		else if ( expect( terminal_symbol_t::TS_MOD) )
-		{
-			token_list.emplace_back( Token( "%", Token::token_t::OPERATOR) );
-		}
-		else if ( expect( terminal_symbol_t::TS_EXP) )
-		{
-			token_list.emplace_back( Token( "^", Token::token_t::OPERATOR) );
-		}
-		else 
+		skip_ws();
+		auto op_col = std::distance( expr.begin(), it_curr_symb );
+
+		// Qualquer operador da tabela, com uma única consulta
+		if ( end_input() or not bares::is_operator( *it_curr_symb ) )
 		{
 			return result;
 		}
 
+		token_list.emplace_back( Token( std::string( 1, *it_curr_symb ), Token::token_t::OPERATOR, op_col ) );
+		next_symbol();
+
 		result = term();
 		if ( result.type != ParserResult::code_t::PARSER_OK 
 			and result.type != ParserResult::code_t::INTEGER_OUT_OF_RANGE and end_input())
@@ -236,9 +234,11 @@ Parser::ParserResult Parser::term ()
 
 	ParserResult result = ParserResult( ParserResult::code_t::MISSING_TERM, std::distance( expr.begin(), it_curr_symb) );
 
+	auto scope_col = std::distance( expr.begin(), it_curr_symb );
+
 	if( expect( terminal_symbol_t::TS_OPENING_SCOPE) )
 	{
-		token_list.emplace_back( Token( "(", Token::token_t::OPENING_SCOPE) );
+		token_list.emplace_back( Token( "(", Token::token_t::OPENING_SCOPE, scope_col ) );
 		result = expression();
 		
 		if(result.type == ParserResult::code_t::PARSER_OK)
@@ -249,7 +249,8 @@ Parser::ParserResult Parser::term ()
 				, std::distance( expr.begin(), it_curr_symb) );
 			}
 
-			token_list.emplace_back( Token( ")", Token::token_t::CLOSING_SCOPE) );
+			token_list.emplace_back( Token( ")", Token::token_t::CLOSING_SCOPE
+				, std::distance( expr.begin(), it_curr_symb ) - 1 ) );
 		}
 	}
 	else
@@ -271,7 +272,8 @@ Parser::ParserResult Parser::integer ()
 
 	if ( accept( terminal_symbol_t::TS_ZERO ) )
 	{
-		token_list.emplace_back( Token( "0", Token::token_t::OPERAND ) );
+		token_list.emplace_back( Token( "0", Token::token_t::OPERAND
+			, std::distance( expr.begin(), begin_token ) ) );
 		return ParserResult( ParserResult::code_t::PARSER_OK );
 	}
 
@@ -310,7 +312,8 @@ Parser::ParserResult Parser::integer ()
 					std::distance( expr.begin(), begin_token ) );
 		}
 
-		token_list.emplace_back( Token( token_str, Token::token_t::OPERAND ) );
+		token_list.emplace_back( Token( token_str, Token::token_t::OPERAND
+			, std::distance( expr.begin(), begin_token ) ) );
 	}
 	else if ( !end_input() )
 	{
@@ -0,0 +1,280 @@
+/**
+ * @file program.cpp
+ * @brief      Implementação dos métodos da classe Program
+ * @details    Compila a expressão posfixa em uma sequência compacta de
+ *             instruções e a executa com um interpretador sem strings. As
+ *             operações marcadas com UNCHECKED vão direto para a aritmética.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cassert>  	// assert
+#include <stdexcept>	// std::invalid_argument
+#include <string>   	// std::stol
+
+#include "program.hpp"
+#include "range_analysis.hpp"
+
+/**
+ * @brief      Compila a expressão posfixa informada
+ *
+ * @param[in]  postfix  Expressão em notação posfixa
+ */
+Program::Program( const std::vector< Token > & postfix )
+{
+	compile( postfix );
+}
+
+/**
+ * @brief      Descarta o programa atual e compila a expressão posfixa
+ *
+ * @param[in]  postfix  Expressão em notação posfixa
+ */
+void Program::compile( const std::vector< Token > & postfix )
+{
+	code.clear();
+	constants.clear();
+	depth = 0;
+
+	code.reserve( postfix.size() );
+
+	size_type height = 0;
+
+	for ( const Token & s : postfix )
+	{
+		if ( s.type == Token::token_t::OPERAND )
+		{
+			code.push_back( Instruction{ Instruction::PUSH, static_cast< std::uint32_t >( constants.size() ) } );
+			constants.push_back( std::stol( s.value ) );
+
+			if ( ++height > depth )
+			{
+				depth = height;
+			}
+		}
+		else if ( s.type == Token::token_t::OPERATOR )
+		{
+			code.push_back( Instruction{ opcode_of( s.value[0] ), 0 } );
+			--height;
+		}
+	}
+
+	// run() usa sempre os literais originais, então a análise pode usar os
+	// valores exatos; run( operands ) só conta com a faixa do tipo
+	exact = code;
+	RangeAnalysis::annotate( exact.data(), exact.size(), constants.data() );
+	assume( std::vector< Interval >( constants.size(), RangeAnalysis::full_range() ) );
+}
+
+/**
+ * @brief      Executa o programa com os literais da expressão original
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult Program::run( void ) const
+{
+	return execute( exact.data(), exact.size(), constants.data(), depth );
+}
+
+/**
+ * @brief      Executa o programa com outros valores nos slots
+ *
+ * @param[in]  operands  Um valor por slot
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult Program::run( const value_type * operands ) const
+{
+	return execute( code.data(), code.size(), operands, depth );
+}
+
+/**
+ * @brief      Refaz a análise de faixas usada por run( operands )
+ *
+ * @param[in]  bounds  Um intervalo por slot
+ *
+ * @return     Quantidade de operações que dispensam verificação
+ */
+Program::size_type Program::assume( const std::vector< Interval > & bounds )
+{
+	return RangeAnalysis::annotate( code.data(), code.size(), bounds.data() );
+}
+
+/**
+ * @brief      Executa uma sequência de instruções que não pertence a uma Program
+ *
+ * @param[in]  code      As instruções, em ordem posfixa
+ * @param[in]  n         Quantidade de instruções
+ * @param[in]  operands  Um valor por slot
+ * @param[in]  depth     Altura máxima da pilha durante a execução
+ *
+ * @return     O mesmo resultado de Evaluator::evaluate_postfix
+ */
+Evaluator::EvaluatorResult Program::execute( const Instruction * code, size_type n,
+	const value_type * operands, size_type depth )
+{
+	Evaluator::EvaluatorResult result;
+
+	if ( n == 0 )
+	{
+		return result;
+	}
+
+	// Pilhas rasas ( o caso comum ) ficam no stack da própria função
+	constexpr size_type LOCAL_DEPTH = 64;
+	value_type local[ LOCAL_DEPTH ];
+	std::vector< value_type > heap;
+
+	value_type * st = local;
+	if ( depth > LOCAL_DEPTH )
+	{
+		heap.resize( depth );
+		st = heap.data();
+	}
+
+	size_type top = 0;
+	auto type = Evaluator::EvaluatorResult::RESULT_OK;
+
+	for ( size_type i = 0; i < n; ++i )
+	{
+		const Instruction & ins = code[ i ];
+
+		switch ( static_cast< unsigned >( ins.op ) )
+		{
+			case Instruction::PUSH:
+				st[ top++ ] = operands[ ins.slot ];
+				continue;
+			case Instruction::ADD | Instruction::UNCHECKED:
+				--top;
+				st[ top - 1 ] += st[ top ];
+				break;
+			case Instruction::SUB | Instruction::UNCHECKED:
+				--top;
+				st[ top - 1 ] -= st[ top ];
+				break;
+			case Instruction::MUL | Instruction::UNCHECKED:
+				--top;
+				st[ top - 1 ] *= st[ top ];
+				break;
+			case Instruction::DIV | Instruction::UNCHECKED:
+				--top;
+				st[ top - 1 ] /= st[ top ];
+				break;
+			case Instruction::MOD | Instruction::UNCHECKED:
+				--top;
+				st[ top - 1 ] %= st[ top ];
+				break;
+			default:
+				--top;
+				if ( ins.op & Instruction::UNCHECKED )
+				{
+					// Demais operações seguras: direto pela função da tabela
+					st[ top - 1 ] = operator_of( ins.op ).kernel( st[ top - 1 ], st[ top ] );
+					break;
+				}
+				result = Evaluator::execute_operator( st[ top - 1 ], st[ top ], symbol_of( ins.op ) );
+				st[ top - 1 ] = result.value;
+				type = result.type;
+				continue;
+		}
+
+		// Operação provada segura: nunca gera erro
+		type = Evaluator::EvaluatorResult::RESULT_OK;
+	}
+
+	result.type = type;
+	result.value = st[ 0 ];
+
+	return result;
+}
+
+/**
+ * @brief      Recupera as instruções do programa
+ *
+ * @return     Vector com as instruções
+ */
+const std::vector< Program::Instruction > & Program::instructions( void ) const
+{
+	return code;
+}
+
+/**
+ * @brief      Recupera os valores originais dos slots
+ *
+ * @return     Vector com um valor por slot
+ */
+const std::vector< Program::value_type > & Program::slots( void ) const
+{
+	return constants;
+}
+
+/**
+ * @brief      Informa quantos slots ( literais ) o programa possui
+ *
+ * @return     Número de slots
+ */
+Program::size_type Program::slot_count( void ) const
+{
+	return constants.size();
+}
+
+/**
+ * @brief      Informa a altura máxima da pilha durante a execução
+ *
+ * @return     Altura máxima da pilha
+ */
+Program::size_type Program::max_depth( void ) const
+{
+	return depth;
+}
+
+/**
+ * @brief      Converte o símbolo de um operador em código de operação
+ *
+ * @param[in]  c     Símbolo do operador ( precisa estar em bares::OPERATORS )
+ *
+ * @return     O código de operação correspondente
+ *
+ * @throws     std::invalid_argument  Se o símbolo não for um operador
+ */
+Program::Instruction::opcode_t Program::opcode_of( char c )
+{
+	auto index = bares::operator_index( c );
+	if ( index == bares::NOT_AN_OPERATOR )
+	{
+		throw std::invalid_argument( std::string( "not an operator: '" ) + c + "'" );
+	}
+
+	return static_cast< Instruction::opcode_t >( 1 + index );
+}
+
+/**
+ * @brief      Linha de bares::OPERATORS de um código de operação
+ *
+ * @param[in]  op    Código de operação ( diferente de PUSH, com ou sem o bit
+ *                   UNCHECKED )
+ *
+ * @return     A descrição do operador
+ */
+const bares::Operator & Program::operator_of( Instruction::opcode_t op )
+{
+	unsigned code = op & ~Instruction::UNCHECKED;
+	assert( code != Instruction::PUSH and code < Instruction::OPCODE_COUNT );
+
+	return bares::OPERATORS[ code - 1 ];
+}
+
+/**
+ * @brief      Converte um código de operação no símbolo do operador
+ *
+ * @param[in]  op    Código de operação ( diferente de PUSH, com ou sem o bit
+ *                   UNCHECKED )
+ *
+ * @return     O símbolo do operador
+ */
+char Program::symbol_of( Instruction::opcode_t op )
+{
+	return operator_of( op ).symbol;
+}
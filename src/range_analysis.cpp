@@ -0,0 +1,229 @@
+/**
+ * @file range_analysis.cpp
+ * @brief      Implementação dos métodos da classe RangeAnalysis
+ * @details    Propagação de intervalos pelas instruções de uma Program.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::min, std::max
+#include <limits>   	// std::numeric_limits
+#include <vector>   	// std::vector
+
+#include "range_analysis.hpp"
+#include "parser.hpp"
+
+namespace
+{
+	using value_type = RangeAnalysis::value_type;
+	using Interval = RangeAnalysis::Interval;
+
+	constexpr value_type MIN = std::numeric_limits< Parser::required_int_type >::min();
+	constexpr value_type MAX = std::numeric_limits< Parser::required_int_type >::max();
+
+	/**
+	 * @brief      Menor intervalo que contém os quatro valores
+	 */
+	Interval hull( value_type w, value_type x, value_type y, value_type z )
+	{
+		return Interval{ std::min( std::min( w, x ), std::min( y, z ) ),
+		                 std::max( std::max( w, x ), std::max( y, z ) ) };
+	}
+
+	/**
+	 * @brief      Determina se o intervalo cabe em Parser::required_int_type
+	 */
+	bool fits( Interval r )
+	{
+		return r.lo >= MIN and r.hi <= MAX;
+	}
+
+	/**
+	 * @brief      Intervalo de uma operação verificada: os valores que cabem
+	 *             na faixa, mais o 0 empilhado quando há erro
+	 */
+	Interval checked( Interval r )
+	{
+		auto lo = std::max( r.lo, MIN );
+		auto hi = std::min( r.hi, MAX );
+
+		if ( lo > hi )
+		{
+			return Interval{ 0, 0 };
+		}
+
+		return Interval{ std::min( lo, value_type( 0 ) ), std::max( hi, value_type( 0 ) ) };
+	}
+
+	/**
+	 * @brief      Maior valor absoluto do intervalo
+	 */
+	value_type magnitude( Interval r )
+	{
+		return std::max( r.lo < 0 ? -r.lo : r.lo, r.hi < 0 ? -r.hi : r.hi );
+	}
+}
+
+/**
+ * @brief      Faixa de Parser::required_int_type
+ *
+ * @return     O intervalo de todos os valores que podem estar na pilha
+ */
+RangeAnalysis::Interval RangeAnalysis::full_range( void )
+{
+	return Interval{ MIN, MAX };
+}
+
+/**
+ * @brief      Intervalo do resultado de uma operação
+ *
+ * @param[in]  op    Código de operação ( sem o bit UNCHECKED )
+ * @param[in]  a     Intervalo do primeiro termo
+ * @param[in]  b     Intervalo do segundo termo
+ * @param[out] safe  Se a operação nunca estoura nem divide por zero
+ *
+ * @return     O intervalo do valor empilhado pela operação
+ */
+RangeAnalysis::Interval RangeAnalysis::apply( Instruction::opcode_t op, Interval a, Interval b, bool & safe )
+{
+	Interval r;
+	safe = false;
+
+	switch ( op )
+	{
+		case Instruction::ADD:
+			r = Interval{ a.lo + b.lo, a.hi + b.hi };
+			break;
+		case Instruction::SUB:
+			r = Interval{ a.lo - b.hi, a.hi - b.lo };
+			break;
+		case Instruction::MUL:
+			r = hull( a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi );
+			break;
+		case Instruction::DIV:
+			if ( b.lo <= 0 and b.hi >= 0 )
+			{
+				// O divisor pode ser zero: o quociente não passa de |a|
+				auto m = magnitude( a );
+				return checked( Interval{ -m, m } );
+			}
+			// Com o sinal do divisor fixo, a divisão truncada é monótona em
+			// cada termo, então os extremos estão nos cantos
+			r = hull( a.lo / b.lo, a.lo / b.hi, a.hi / b.lo, a.hi / b.hi );
+			break;
+		case Instruction::MOD:
+			if ( b.lo <= 0 and b.hi >= 0 )
+			{
+				return checked( Interval{ a.lo, a.hi } );
+			}
+			else
+			{
+				// O resto tem o sinal do dividendo e é menor que |b|
+				auto m = magnitude( b ) - 1;
+				r = Interval{ a.lo >= 0 ? 0 : std::max( a.lo, -m ), a.hi <= 0 ? 0 : std::min( a.hi, m ) };
+			}
+			break;
+		case Instruction::POW:
+		{
+			// Só expoentes não negativos com |a|^b_max dentro da faixa
+			if ( b.lo < 0 )
+			{
+				return full_range();
+			}
+
+			auto m = magnitude( a );
+			value_type bound = 1;
+			for ( value_type e = 0; e < b.hi and m > 1; ++e )
+			{
+				bound *= m;
+				if ( bound > MAX )
+				{
+					return full_range();
+				}
+			}
+
+			r = Interval{ a.lo >= 0 ? 0 : -bound, bound };
+			break;
+		}
+		default:
+			// Operador da tabela sem análise: nunca é provado seguro
+			return full_range();
+	}
+
+	if ( not fits( r ) )
+	{
+		return checked( r );
+	}
+
+	safe = true;
+	return r;
+}
+
+/**
+ * @brief      Marca com UNCHECKED as operações provadas seguras
+ *
+ * @param      code   As instruções, em ordem posfixa
+ * @param[in]  n      Quantidade de instruções
+ * @param[in]  slots  A faixa de cada slot
+ *
+ * @return     Quantidade de operações provadas seguras
+ */
+RangeAnalysis::size_type RangeAnalysis::annotate( Instruction * code, size_type n, const Interval * slots )
+{
+	std::vector< Interval > st;
+	st.reserve( n );
+	size_type proven = 0;
+
+	for ( size_type i = 0; i < n; ++i )
+	{
+		auto & ins = code[ i ];
+
+		if ( ins.op == Instruction::PUSH )
+		{
+			st.push_back( slots[ ins.slot ] );
+			continue;
+		}
+
+		auto op = static_cast< Instruction::opcode_t >( ins.op & ~Instruction::UNCHECKED );
+		auto b = st.back();
+		st.pop_back();
+
+		bool safe;
+		st.back() = apply( op, st.back(), b, safe );
+
+		ins.op = safe ? static_cast< Instruction::opcode_t >( op | Instruction::UNCHECKED ) : op;
+		proven += safe;
+	}
+
+	return proven;
+}
+
+/**
+ * @brief      Marca as operações provadas seguras para valores exatos nos slots
+ *
+ * @param      code       As instruções, em ordem posfixa
+ * @param[in]  n          Quantidade de instruções
+ * @param[in]  constants  O valor de cada slot
+ *
+ * @return     Quantidade de operações provadas seguras
+ */
+RangeAnalysis::size_type RangeAnalysis::annotate( Instruction * code, size_type n, const value_type * constants )
+{
+	std::vector< Interval > slots;
+
+	for ( size_type i = 0; i < n; ++i )
+	{
+		if ( code[ i ].op == Instruction::PUSH )
+		{
+			if ( code[ i ].slot >= slots.size() )
+			{
+				slots.resize( code[ i ].slot + 1 );
+			}
+			slots[ code[ i ].slot ] = Interval{ constants[ code[ i ].slot ], constants[ code[ i ].slot ] };
+		}
+	}
+
+	return annotate( code, n, slots.data() );
+}
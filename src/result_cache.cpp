@@ -0,0 +1,377 @@
+/**
+ * @file result_cache.cpp
+ * @brief      Implementação dos métodos da classe ResultCache
+ * @details    Tabela hash com sondagem linear limitada a cache::PROBE
+ *             posições, sem remoções ( uma posição só é reaproveitada por
+ *             substituição ), então a busca pode parar na primeira posição
+ *             vazia.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno
+#include <cstring>  	// std::memcmp, std::memcpy, std::strerror
+
+#include <fcntl.h>  	// open
+#include <sys/file.h>	// flock
+#include <sys/mman.h>	// mmap, munmap
+#include <sys/stat.h>	// fstat
+#include <unistd.h> 	// ftruncate, pwrite, link, unlink, close, getpid
+
+#include "result_cache.hpp"
+
+static_assert( sizeof( cache::Header ) == 64, "Header deve ter 64 bytes" );
+static_assert( sizeof( cache::Slot ) == 48, "Slot deve ter 48 bytes" );
+
+constexpr ResultCache::size_type ResultCache::DEFAULT_LIMIT;
+
+namespace
+{
+	/**
+	 * @brief      Mistura final do splitmix64
+	 */
+	inline std::uint64_t mix( std::uint64_t h )
+	{
+		h ^= h >> 30;
+		h *= 0xbf58476d1ce4e5b9ull;
+		h ^= h >> 27;
+		h *= 0x94d049bb133111ebull;
+		h ^= h >> 31;
+		return h;
+	}
+
+	template < typename T >
+	inline T load( const T & field )
+	{
+		return __atomic_load_n( &field, __ATOMIC_RELAXED );
+	}
+
+	template < typename T >
+	inline void store( T & field, T value )
+	{
+		__atomic_store_n( &field, value, __ATOMIC_RELAXED );
+	}
+}
+
+/**
+ * @brief      Desfaz o mapeamento
+ */
+ResultCache::~ResultCache()
+{
+	close();
+}
+
+/**
+ * @brief      Calcula o hash de 128 bits da expressão normalizada
+ *
+ * @param[in]  expr  A expressão
+ * @param[out] key   As duas metades do hash
+ */
+void ResultCache::key_of( const std::string & expr, std::uint64_t key[2] )
+{
+	// Duas funções independentes: FNV-1a e uma multiplicativa com splitmix
+	std::uint64_t a = 14695981039346656037ull;
+	std::uint64_t b = 0x9e3779b97f4a7c15ull ^ expr.size();
+
+	for ( char ch : expr )
+	{
+		// O Parser trata tabulação e espaço da mesma forma
+		unsigned char c = ch == '\t' ? ' ' : static_cast< unsigned char >( ch );
+
+		a ^= c;
+		a *= 1099511628211ull;
+
+		b = ( b ^ c ) * 0xff51afd7ed558ccdull;
+		b ^= b >> 32;
+	}
+
+	key[0] = mix( a ^ expr.size() );
+	key[1] = mix( b );
+}
+
+/**
+ * @brief      Cria um arquivo vazio com a capacidade que cabe no limite
+ *
+ * @param[in]  path   Caminho do arquivo
+ * @param[in]  limit  Tamanho máximo do arquivo
+ *
+ * @return     Vazio se criou ( ou se outro processo criou antes ), ou a
+ *             descrição do erro
+ */
+std::string ResultCache::create( const std::string & path, size_type limit )
+{
+	std::uint64_t capacity = 64;
+	while ( sizeof( cache::Header ) + 2 * capacity * sizeof( cache::Slot ) <= limit )
+	{
+		capacity *= 2;
+	}
+
+	// O arquivo é montado ao lado e só aparece no caminho final completo
+	auto tmp = path + ".tmp." + std::to_string( getpid() );
+	int f = ::open( tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+	if ( f < 0 )
+	{
+		return "cannot create " + tmp + ": " + std::strerror( errno );
+	}
+
+	cache::Header h{};
+	std::memcpy( h.magic, cache::MAGIC, sizeof( h.magic ) );
+	h.version = cache::VERSION;
+	h.slot_size = sizeof( cache::Slot );
+	h.capacity = capacity;
+
+	bool ok = ftruncate( f, sizeof( cache::Header ) + capacity * sizeof( cache::Slot ) ) == 0
+		and pwrite( f, &h, sizeof( h ), 0 ) == static_cast< ssize_t >( sizeof( h ) );
+	auto err = errno;
+	::close( f );
+
+	// link() não substitui um cache criado por outro processo nesse meio tempo
+	if ( ok and link( tmp.c_str(), path.c_str() ) != 0 and errno != EEXIST )
+	{
+		ok = false;
+		err = errno;
+	}
+	unlink( tmp.c_str() );
+
+	return ok ? "" : "cannot create " + path + ": " + std::strerror( err );
+}
+
+/**
+ * @brief      Abre ( ou cria ) o arquivo do cache
+ *
+ * @param[in]  path   Caminho do arquivo
+ * @param[in]  limit  Tamanho máximo do arquivo, usado apenas ao criá-lo
+ *
+ * @return     Vazio se abriu, ou a descrição do erro
+ */
+std::string ResultCache::open( const std::string & path, size_type limit )
+{
+	close();
+
+	fd = ::open( path.c_str(), O_RDWR | O_CLOEXEC );
+	if ( fd < 0 and errno == ENOENT )
+	{
+		auto error = create( path, limit );
+		if ( not error.empty() )
+		{
+			return error;
+		}
+		fd = ::open( path.c_str(), O_RDWR | O_CLOEXEC );
+	}
+	if ( fd < 0 and errno == EACCES )
+	{
+		fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+	}
+	if ( fd < 0 )
+	{
+		return "cannot open " + path + ": " + std::strerror( errno );
+	}
+
+	// Quem não consegue a trava apenas lê
+	writer = ( fcntl( fd, F_GETFL ) & O_ACCMODE ) == O_RDWR and flock( fd, LOCK_EX | LOCK_NB ) == 0;
+
+	struct stat st;
+	if ( fstat( fd, &st ) != 0 or static_cast< size_type >( st.st_size ) < sizeof( cache::Header ) )
+	{
+		close();
+		return "truncated cache " + path;
+	}
+
+	length = st.st_size;
+	void * m = mmap( nullptr, length, writer ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0 );
+	if ( m == MAP_FAILED )
+	{
+		length = 0;
+		close();
+		return "cannot map " + path;
+	}
+
+	base = static_cast< unsigned char * >( m );
+	header = reinterpret_cast< cache::Header * >( base );
+
+	if ( std::memcmp( header->magic, cache::MAGIC, sizeof( header->magic ) ) != 0
+		or header->version != cache::VERSION
+		or header->slot_size != sizeof( cache::Slot )
+		or header->capacity == 0
+		or ( header->capacity & ( header->capacity - 1 ) ) != 0
+		or length != sizeof( cache::Header ) + header->capacity * sizeof( cache::Slot ) )
+	{
+		close();
+		return "not a compatible bares cache: " + path;
+	}
+
+	slots = reinterpret_cast< cache::Slot * >( base + sizeof( cache::Header ) );
+	mask = header->capacity - 1;
+
+	if ( writer )
+	{
+		// Cada execução do escritor é uma geração; 0 marca posição vazia
+		generation = __atomic_add_fetch( &header->generation, 1, __ATOMIC_RELAXED );
+		if ( generation == 0 )
+		{
+			generation = __atomic_add_fetch( &header->generation, 1, __ATOMIC_RELAXED );
+		}
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Desfaz o mapeamento e libera a trava
+ */
+void ResultCache::close( void )
+{
+	if ( base != nullptr )
+	{
+		munmap( base, length );
+	}
+	if ( fd >= 0 )
+	{
+		::close( fd );
+	}
+
+	base = nullptr;
+	header = nullptr;
+	slots = nullptr;
+	length = 0;
+	mask = 0;
+	fd = -1;
+	writer = false;
+}
+
+/**
+ * @brief      Procura o resultado de uma expressão
+ *
+ * @param[in]  expr  A expressão
+ * @param[out] out   O resultado guardado
+ *
+ * @return     True se encontrou, False caso contrário
+ */
+bool ResultCache::lookup( const std::string & expr, Result & out )
+{
+	if ( slots == nullptr )
+	{
+		return false;
+	}
+
+	std::uint64_t key[2];
+	key_of( expr, key );
+
+	for ( std::size_t p = 0; p < cache::PROBE; ++p )
+	{
+		auto & s = slots[ ( key[0] + p ) & mask ];
+
+		auto seq = __atomic_load_n( &s.seq, __ATOMIC_ACQUIRE );
+		if ( seq & 1 )
+		{
+			continue;
+		}
+		if ( load( s.stamp ) == 0 )
+		{
+			return false;
+		}
+		if ( load( s.key[0] ) != key[0] or load( s.key[1] ) != key[1] )
+		{
+			continue;
+		}
+
+		auto value = load( s.value );
+		auto at_col = load( s.at_col );
+		auto parser_code = load( s.parser_code );
+		auto evaluator_code = load( s.evaluator_code );
+
+		__atomic_thread_fence( __ATOMIC_ACQUIRE );
+		if ( load( s.seq ) != seq )
+		{
+			// Alterada durante a leitura
+			return false;
+		}
+
+		out.parsed = Parser::ParserResult( static_cast< Parser::ParserResult::code_t >( parser_code ), at_col );
+		out.evaluated = Evaluator::EvaluatorResult( value, static_cast< Evaluator::EvaluatorResult::code_t >( evaluator_code ) );
+
+		if ( writer )
+		{
+			store( s.stamp, generation );
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief      Guarda o resultado de uma expressão
+ *
+ * @param[in]  expr    A expressão
+ * @param[in]  result  O resultado
+ */
+void ResultCache::insert( const std::string & expr, const Result & result )
+{
+	if ( not writer )
+	{
+		return;
+	}
+
+	std::uint64_t key[2];
+	key_of( expr, key );
+
+	// A mesma chave ou a primeira vazia; senão, a usada há mais gerações
+	cache::Slot * target = nullptr;
+	std::uint32_t oldest = 0;
+
+	for ( std::size_t p = 0; p < cache::PROBE; ++p )
+	{
+		auto & s = slots[ ( key[0] + p ) & mask ];
+
+		if ( s.stamp == 0 or ( s.key[0] == key[0] and s.key[1] == key[1] ) )
+		{
+			target = &s;
+			break;
+		}
+
+		auto age = generation - s.stamp;
+		if ( target == nullptr or age > oldest )
+		{
+			target = &s;
+			oldest = age;
+		}
+	}
+
+	auto seq = target->seq;
+	store( target->seq, seq + 1 );
+	__atomic_thread_fence( __ATOMIC_RELEASE );
+
+	store( target->stamp, generation );
+	store( target->key[0], key[0] );
+	store( target->key[1], key[1] );
+	store( target->value, static_cast< std::int64_t >( result.evaluated.value ) );
+	store( target->at_col, static_cast< std::int64_t >( result.parsed.at_col ) );
+	store( target->parser_code, static_cast< std::uint8_t >( result.parsed.type ) );
+	store( target->evaluator_code, static_cast< std::uint8_t >( result.evaluated.type ) );
+
+	__atomic_store_n( &target->seq, seq + 2, __ATOMIC_RELEASE );
+}
+
+/**
+ * @brief      Informa se este processo pode escrever no cache
+ *
+ * @return     True se possui a trava de escrita
+ */
+bool ResultCache::is_writer( void ) const
+{
+	return writer;
+}
+
+/**
+ * @brief      Informa quantas posições a tabela possui
+ *
+ * @return     A capacidade, 0 se o cache está fechado
+ */
+ResultCache::size_type ResultCache::capacity( void ) const
+{
+	return header == nullptr ? 0 : header->capacity;
+}
@@ -0,0 +1,247 @@
+/**
+ * @file shape_batch.cpp
+ * @brief      Implementação dos métodos da classe ShapeBatch
+ * @details    Agrupa as linhas por assinatura e avalia cada grupo com vetores
+ *             de LANES inteiros de 32 bits ( extensão de vetores do GCC ). Os
+ *             valores na pilha nunca saem da faixa de
+ *             Parser::required_int_type, então somas, produtos e quocientes
+ *             de dois deles cabem em 32 bits e o teste de estouro pode ser
+ *             feito depois da operação, como no Evaluator.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <limits>   	// std::numeric_limits
+#include <memory>   	// std::align
+#include <string>   	// std::stol
+#include <unordered_map>	// std::unordered_map
+
+#include "shape_batch.hpp"
+
+constexpr ShapeBatch::size_type ShapeBatch::LANES;
+
+namespace
+{
+	/**
+	 * @brief      LANES inteiros de 32 bits operados juntos
+	 */
+	typedef std::int32_t lanes_t __attribute__(( vector_size( ShapeBatch::LANES * sizeof( std::int32_t ) ) ));
+
+	constexpr std::int32_t MIN = std::numeric_limits< Parser::required_int_type >::min();
+	constexpr std::int32_t MAX = std::numeric_limits< Parser::required_int_type >::max();
+}
+
+/**
+ * @brief      Calcula a assinatura de uma lista de tokens
+ *
+ * @param[in]  tokens  Tokens emitidos pelo Parser
+ *
+ * @return     Tipos e operadores, com '#' no lugar de cada literal
+ */
+std::string ShapeBatch::signature( const std::vector< Token > & tokens )
+{
+	std::string sig;
+	sig.reserve( tokens.size() );
+
+	for ( const auto & t : tokens )
+	{
+		// Operadores e parênteses têm um único caractere
+		sig.push_back( t.type == Token::token_t::OPERAND ? '#' : t.value[0] );
+	}
+
+	return sig;
+}
+
+/**
+ * @brief      Avalia um lote de expressões
+ *
+ * @param[in]  lines  As expressões, uma por linha
+ *
+ * @return     Um resultado por linha, na ordem da entrada
+ */
+std::vector< ShapeBatch::LineResult > ShapeBatch::evaluate( const std::vector< std::string > & lines )
+{
+	std::vector< LineResult > results( lines.size() );
+	std::vector< Shape > groups;
+	std::unordered_map< std::string, size_type > index;
+
+	for ( size_type i = 0; i < lines.size(); ++i )
+	{
+		results[ i ].parsed = parser.parse( lines[ i ] );
+
+		if ( results[ i ].parsed.type != Parser::ParserResult::PARSER_OK )
+		{
+			continue;
+		}
+
+		auto tokens = parser.get_tokens();
+		auto found = index.emplace( signature( tokens ), groups.size() );
+
+		if ( found.second )
+		{
+			// Primeira linha deste formato: shunting-yard e compilação
+			groups.emplace_back();
+			groups.back().program.compile( evaluator.infix_to_postfix( tokens ) );
+		}
+
+		auto & g = groups[ found.first->second ];
+		g.lines.push_back( i );
+
+		// O shunting-yard não reordena os literais, então a ordem infixa é
+		// a ordem dos slots
+		for ( const auto & t : tokens )
+		{
+			if ( t.type == Token::token_t::OPERAND )
+			{
+				g.operands.push_back( static_cast< std::int32_t >( std::stol( t.value ) ) );
+			}
+		}
+	}
+
+	for ( const auto & g : groups )
+	{
+		run_lanes( g, results );
+	}
+
+	shapes = groups.size();
+
+	return results;
+}
+
+/**
+ * @brief      Avalia todas as linhas de um grupo, LANES por vez
+ *
+ * @param[in]  shape    O grupo
+ * @param      results  Onde gravar o resultado de cada linha
+ */
+void ShapeBatch::run_lanes( const Shape & shape, std::vector< LineResult > & results )
+{
+	using Instruction = Program::Instruction;
+
+	const auto & code = shape.program.instructions();
+	auto slots = shape.program.slot_count();
+	auto depth = shape.program.max_depth();
+
+	// Pilha de vetores: no stack da função para expressões rasas; senão, na
+	// heap com o alinhamento do vetor
+	constexpr size_type LOCAL_DEPTH = 64;
+	lanes_t local[ LOCAL_DEPTH ];
+	std::vector< unsigned char > heap;
+	lanes_t * st = local;
+
+	if ( depth > LOCAL_DEPTH )
+	{
+		heap.resize( ( depth + 1 ) * sizeof( lanes_t ) );
+		void * p = heap.data();
+		auto space = heap.size();
+		st = static_cast< lanes_t * >( std::align( alignof( lanes_t ), depth * sizeof( lanes_t ), p, space ) );
+	}
+
+	const lanes_t zero = {};
+	const lanes_t min = zero + MIN;
+	const lanes_t max = zero + MAX;
+	const lanes_t dbz_code = zero + static_cast< std::int32_t >( Evaluator::EvaluatorResult::DIVISION_BY_ZERO );
+	const lanes_t ovf_code = zero + static_cast< std::int32_t >( Evaluator::EvaluatorResult::NUMERIC_OVERFLOW );
+
+	auto count = shape.lines.size();
+
+	for ( size_type first = 0; first < count; first += LANES )
+	{
+		auto width = count - first < LANES ? count - first : LANES;
+		size_type top = 0;
+		lanes_t type = zero;
+
+		for ( const auto & ins : code )
+		{
+			if ( ins.op == Instruction::PUSH )
+			{
+				// Coleta o slot de cada linha ( os literais estão linha após linha )
+				lanes_t v = zero;
+				for ( size_type k = 0; k < width; ++k )
+				{
+					v[ k ] = shape.operands[ ( first + k ) * slots + ins.slot ];
+				}
+				st[ top++ ] = v;
+				continue;
+			}
+
+			--top;
+			lanes_t a = st[ top - 1 ];
+			lanes_t b = st[ top ];
+			lanes_t r;
+			lanes_t dbz = zero;
+			bool unchecked = ins.op & Instruction::UNCHECKED;
+			auto op = static_cast< Instruction::opcode_t >( ins.op & ~Instruction::UNCHECKED );
+
+			switch ( op )
+			{
+				case Instruction::ADD:
+					r = a + b;
+					break;
+				case Instruction::SUB:
+					r = a - b;
+					break;
+				case Instruction::MUL:
+					r = a * b;
+					break;
+				case Instruction::DIV:
+				case Instruction::MOD:
+					// Divisor zero vira 1 e a faixa é marcada como erro
+					dbz = b == zero;
+					b -= dbz;
+					r = op == Instruction::DIV ? a / b : a % b;
+					break;
+				default:
+				{
+					// Demais operadores ( "^" ) não têm SIMD: uma faixa por
+					// vez, pelo Evaluator
+					char symbol = Program::symbol_of( op );
+					lanes_t codes = zero;
+					for ( size_type k = 0; k < LANES; ++k )
+					{
+						auto res = Evaluator::execute_operator( a[ k ], b[ k ], symbol );
+						r[ k ] = static_cast< std::int32_t >( res.value );
+						codes[ k ] = res.type;
+					}
+					st[ top - 1 ] = r;
+					type = codes;
+					continue;
+				}
+			}
+
+			if ( unchecked )
+			{
+				st[ top - 1 ] = r;
+				type = zero;
+				continue;
+			}
+
+			// Estouro e divisão por zero por máscara: faixas com erro ficam
+			// com 0 e com o código do erro, como em execute_operator
+			lanes_t ovf = ( r > max ) | ( r < min );
+			lanes_t error = ovf | dbz;
+
+			st[ top - 1 ] = r & ~error;
+			type = ( dbz & dbz_code ) | ( ovf & ~dbz & ovf_code );
+		}
+
+		for ( size_type k = 0; k < width; ++k )
+		{
+			auto & out = results[ shape.lines[ first + k ] ].evaluated;
+			out.value = st[0][ k ];
+			out.type = static_cast< Evaluator::EvaluatorResult::code_t >( type[ k ] );
+		}
+	}
+}
+
+/**
+ * @brief      Informa quantos grupos o último lote formou
+ *
+ * @return     Quantidade de grupos
+ */
+ShapeBatch::size_type ShapeBatch::shape_count( void ) const
+{
+	return shapes;
+}
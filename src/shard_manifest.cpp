@@ -0,0 +1,303 @@
+/**
+ * @file shard_manifest.cpp
+ * @brief      Implementação do manifesto e dos registros das partes
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno
+#include <cstring>  	// std::strerror
+#include <algorithm>	// std::count
+#include <fstream>  	// std::ifstream, std::ofstream
+#include <sstream>  	// std::ostringstream
+
+#include <stdio.h>  	// rename
+#include <fcntl.h>  	// open
+#include <unistd.h> 	// read, close, unlink
+
+#include "shard_manifest.hpp"
+
+namespace
+{
+	constexpr char MANIFEST_MAGIC[] = "bares-shards";
+	constexpr char DONE_MAGIC[] = "bares-shard-done";
+	constexpr int FORMAT_VERSION = 1;
+
+	/**
+	 * @brief      Grava um texto ao lado e o renomeia por cima do destino
+	 *
+	 * @param[in]  path  Destino
+	 * @param[in]  text  Conteúdo
+	 *
+	 * @return     Vazio se gravou, ou a descrição do erro
+	 */
+	std::string replace_file( const std::string & path, const std::string & text )
+	{
+		auto tmp = path + ".tmp";
+		{
+			std::ofstream out( tmp, std::ios::binary | std::ios::trunc );
+			out << text;
+			out.flush();
+			if ( not out )
+			{
+				unlink( tmp.c_str() );
+				return "cannot write " + tmp;
+			}
+		}
+
+		if ( ::rename( tmp.c_str(), path.c_str() ) != 0 )
+		{
+			auto err = errno;
+			unlink( tmp.c_str() );
+			return "cannot write " + path + ": " + std::strerror( err );
+		}
+
+		return "";
+	}
+}
+
+/**
+ * @brief      Acrescenta bytes
+ *
+ * @param[in]  data  Os bytes
+ * @param[in]  n     Quantidade de bytes
+ */
+void sharding::Checksum::update( const char * data, std::size_t n )
+{
+	for ( std::size_t i = 0; i < n; ++i )
+	{
+		h ^= static_cast< unsigned char >( data[ i ] );
+		h *= 1099511628211ull;
+	}
+}
+
+/**
+ * @brief      O checksum dos bytes vistos até agora
+ */
+std::uint64_t sharding::Checksum::value( void ) const
+{
+	return h;
+}
+
+/**
+ * @brief      Estima o custo de avaliar uma linha
+ *
+ * @param[in]  line  A linha, sem o '\n'
+ * @param[in]  n     Tamanho
+ *
+ * @return     Bytes mais TOKEN_WEIGHT por token
+ */
+std::uint64_t sharding::line_cost( const char * line, std::size_t n )
+{
+	std::uint64_t tokens = 0;
+	bool in_number = false;
+
+	for ( std::size_t i = 0; i < n; ++i )
+	{
+		char c = line[ i ];
+		bool digit = c >= '0' and c <= '9';
+
+		// Cada número conta uma vez; os demais símbolos, exceto espaços, um
+		// por caractere
+		tokens += digit ? not in_number : ( c != ' ' and c != '\t' );
+		in_number = digit;
+	}
+
+	return n + TOKEN_WEIGHT * tokens;
+}
+
+/**
+ * @brief      Conta as linhas e os bytes de um arquivo e calcula o checksum
+ *
+ * @param[in]  path     Caminho
+ * @param[out] summary  Linhas ( '\n' ), bytes e checksum
+ *
+ * @return     Vazio se leu, ou a descrição do erro
+ */
+std::string sharding::scan_file( const std::string & path, Done & summary )
+{
+	int fd = ::open( path.c_str(), O_RDONLY );
+	if ( fd < 0 )
+	{
+		return "cannot open " + path + ": " + std::strerror( errno );
+	}
+
+	std::vector< char > block( 1 << 20 );
+	Checksum checksum;
+	summary = Done();
+
+	while ( true )
+	{
+		auto n = ::read( fd, block.data(), block.size() );
+		if ( n < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( n < 0 )
+		{
+			auto err = errno;
+			::close( fd );
+			return "cannot read " + path + ": " + std::strerror( err );
+		}
+		if ( n == 0 )
+		{
+			break;
+		}
+
+		checksum.update( block.data(), n );
+		summary.bytes += n;
+		summary.lines += std::count( block.data(), block.data() + n, '\n' );
+	}
+
+	::close( fd );
+	summary.checksum = checksum.value();
+
+	return "";
+}
+
+/**
+ * @brief      Caminho de um arquivo de parte
+ *
+ * @param[in]  manifest  Caminho do manifesto
+ * @param[in]  file      Nome gravado no manifesto
+ *
+ * @return     O caminho, no diretório do manifesto
+ */
+std::string sharding::resolve( const std::string & manifest, const std::string & file )
+{
+	auto slash = manifest.rfind( '/' );
+	return slash == std::string::npos ? file : manifest.substr( 0, slash + 1 ) + file;
+}
+
+/**
+ * @brief      Grava o manifesto
+ *
+ * @param[in]  path      Caminho
+ * @param[in]  manifest  O manifesto
+ *
+ * @return     Vazio se gravou, ou a descrição do erro
+ */
+std::string sharding::write_manifest( const std::string & path, const Manifest & manifest )
+{
+	std::ostringstream text;
+
+	text << MANIFEST_MAGIC << " " << FORMAT_VERSION << "\n";
+	text << "input " << manifest.lines << " " << manifest.bytes << " " << manifest.input << "\n";
+	text << "shards " << manifest.shards.size() << "\n";
+	for ( const auto & s : manifest.shards )
+	{
+		text << "shard " << s.first_line << " " << s.lines << " " << s.bytes << " " << s.cost << " "
+			<< s.checksum << " " << s.file << "\n";
+	}
+
+	return replace_file( path, text.str() );
+}
+
+/**
+ * @brief      Lê o manifesto
+ *
+ * @param[in]  path      Caminho
+ * @param[out] manifest  O manifesto
+ *
+ * @return     Vazio se leu, ou a descrição do erro
+ */
+std::string sharding::read_manifest( const std::string & path, Manifest & manifest )
+{
+	std::ifstream in( path );
+	if ( not in )
+	{
+		return "cannot open " + path;
+	}
+
+	std::string magic, key;
+	int version = 0;
+	std::size_t count = 0;
+
+	manifest = Manifest();
+
+	in >> magic >> version;
+	in >> key >> manifest.lines >> manifest.bytes;
+	in.ignore( 1 );
+	std::getline( in, manifest.input );
+	if ( not in or magic != MANIFEST_MAGIC or version != FORMAT_VERSION or key != "input" )
+	{
+		return "not a bares shard manifest: " + path;
+	}
+
+	in >> key >> count;
+	if ( not in or key != "shards" )
+	{
+		return "not a bares shard manifest: " + path;
+	}
+
+	std::uint64_t next_line = 0;
+	for ( std::size_t i = 0; i < count; ++i )
+	{
+		Shard s;
+		in >> key >> s.first_line >> s.lines >> s.bytes >> s.cost >> s.checksum;
+		in.ignore( 1 );
+		std::getline( in, s.file );
+
+		// As partes precisam cobrir a entrada em ordem, sem buracos
+		if ( not in or key != "shard" or s.first_line != next_line )
+		{
+			return "corrupt shard manifest: " + path;
+		}
+
+		next_line += s.lines;
+		manifest.shards.push_back( s );
+	}
+
+	if ( next_line != manifest.lines )
+	{
+		return "corrupt shard manifest: " + path;
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Grava o registro de uma parte concluída
+ *
+ * @param[in]  path  Caminho
+ * @param[in]  done  O registro
+ *
+ * @return     Vazio se gravou, ou a descrição do erro
+ */
+std::string sharding::write_done( const std::string & path, const Done & done )
+{
+	std::ostringstream text;
+	text << DONE_MAGIC << " " << FORMAT_VERSION << " " << done.lines << " " << done.bytes << " " << done.checksum << "\n";
+
+	return replace_file( path, text.str() );
+}
+
+/**
+ * @brief      Lê o registro de uma parte concluída
+ *
+ * @param[in]  path  Caminho
+ * @param[out] done  O registro
+ *
+ * @return     Vazio se leu, ou a descrição do erro
+ */
+std::string sharding::read_done( const std::string & path, Done & done )
+{
+	std::ifstream in( path );
+	if ( not in )
+	{
+		return "missing " + path + " ( shard not finished )";
+	}
+
+	std::string magic;
+	int version = 0;
+
+	in >> magic >> version >> done.lines >> done.bytes >> done.checksum;
+	if ( not in or magic != DONE_MAGIC or version != FORMAT_VERSION )
+	{
+		return "corrupt " + path;
+	}
+
+	return "";
+}
@@ -0,0 +1,225 @@
+/**
+ * @file template_expander.cpp
+ * @brief      Implementação dos métodos da classe TemplateExpander
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstring>  	// std::memchr
+
+#include "template_expander.hpp"
+
+namespace
+{
+	constexpr char OFFSET_PREFIX[] = "Offset ";
+	constexpr char OFFSET_SUFFIX[] = ": ";
+}
+
+/**
+ * @brief      Construtor do TemplateExpander
+ *
+ * @param      out_     Onde escrever o documento
+ * @param      errors_  Onde escrever os erros
+ */
+TemplateExpander::TemplateExpander( OutputWriter & out_, OutputWriter & errors_ )
+	: out( out_ )
+	, errors( errors_ )
+{ /* Vazio */ }
+
+/**
+ * @brief      Avalia um trecho e escreve o valor ( ou o trecho original, se
+ *             houver erro )
+ *
+ * @param[in]  start  Início do trecho, no '$'
+ * @param[in]  end    Depois do '}'
+ * @param[in]  at     Posição do '$' no documento
+ */
+void TemplateExpander::expand( const char * start, const char * end, std::uint64_t at )
+{
+	std::string expr( start + 2, end - 1 );
+
+	auto result = parser.parse( expr );
+	Evaluator::EvaluatorResult resultado;
+
+	if ( result.type == Parser::ParserResult::PARSER_OK )
+	{
+		resultado = evaluator.evaluate_postfix( evaluator.infix_to_postfix( parser.get_tokens() ) );
+
+		if ( resultado.type == Evaluator::EvaluatorResult::code_t::RESULT_OK )
+		{
+			char value[ OutputWriter::MAX_INTEGER_CHARS ];
+			out.write( value, OutputWriter::format_integer( value, resultado.value ) - value );
+			++expanded;
+			return;
+		}
+	}
+
+	// O trecho fica como estava e o erro vai para a outra saída
+	out.write( start, end - start );
+	++failed;
+
+	char prefix[ sizeof( OFFSET_PREFIX ) + OutputWriter::MAX_INTEGER_CHARS + sizeof( OFFSET_SUFFIX ) ];
+	char * p = prefix;
+	std::memcpy( p, OFFSET_PREFIX, sizeof( OFFSET_PREFIX ) - 1 );
+	p = OutputWriter::format_integer( p + sizeof( OFFSET_PREFIX ) - 1, static_cast< long long >( at ) );
+	std::memcpy( p, OFFSET_SUFFIX, sizeof( OFFSET_SUFFIX ) - 1 );
+	p += sizeof( OFFSET_SUFFIX ) - 1;
+	errors.write( prefix, p - prefix );
+
+	if ( result.type != Parser::ParserResult::PARSER_OK )
+	{
+		errors.write_parser_error( result );
+	}
+	else
+	{
+		errors.write_evaluator_error( resultado );
+	}
+}
+
+/**
+ * @brief      Processa bytes que começam fora de um trecho
+ *
+ * @param[in]  p     Início
+ * @param[in]  end   Fim
+ * @param[in]  at    Posição de p no documento
+ */
+void TemplateExpander::scan( const char * p, const char * end, std::uint64_t at )
+{
+	while ( p < end )
+	{
+		auto dollar = static_cast< const char * >( std::memchr( p, '$', end - p ) );
+		if ( dollar == nullptr )
+		{
+			out.write( p, end - p );
+			return;
+		}
+
+		// Todo o texto até o '$' sai de uma vez
+		out.write( p, dollar - p );
+		at += dollar - p;
+		p = dollar;
+
+		if ( p + 1 == end )
+		{
+			pending.assign( p, 1 );
+			return;
+		}
+		if ( p[1] != '{' )
+		{
+			out.write( p, 1 );
+			++p;
+			++at;
+			continue;
+		}
+
+		auto body = p + 2;
+		auto close = static_cast< const char * >( std::memchr( body, '}', end - body ) );
+		auto limit = close == nullptr ? end : close;
+
+		if ( std::memchr( body, '\n', limit - body ) != nullptr )
+		{
+			// Sem fechamento na mesma linha: não é um trecho
+			out.write( p, 2 );
+			p += 2;
+			at += 2;
+			continue;
+		}
+		if ( close == nullptr )
+		{
+			pending.assign( p, end - p );
+			return;
+		}
+
+		expand( p, close + 1, at );
+		at += close + 1 - p;
+		p = close + 1;
+	}
+}
+
+/**
+ * @brief      Processa o próximo bloco do documento
+ *
+ * @param[in]  data  Os bytes
+ * @param[in]  n     Quantidade de bytes
+ */
+void TemplateExpander::feed( const char * data, size_type n )
+{
+	const char * p = data;
+	const char * end = data + n;
+	std::uint64_t at = offset;
+
+	offset += n;
+
+	if ( pending.size() == 1 and p < end )
+	{
+		// O bloco anterior terminou em '$'
+		if ( *p == '{' )
+		{
+			pending += '{';
+			++p;
+			++at;
+		}
+		else
+		{
+			out.write( pending.data(), 1 );
+			pending.clear();
+		}
+	}
+
+	if ( pending.size() > 1 )
+	{
+		auto close = static_cast< const char * >( std::memchr( p, '}', end - p ) );
+		auto limit = close == nullptr ? end : close;
+
+		if ( std::memchr( p, '\n', limit - p ) != nullptr )
+		{
+			// O "${" não fecha na mesma linha e vira texto. O que foi
+			// guardado não tem '}', então nenhum "${" dentro dele fecha
+			// antes do '\n' e tudo é copiado como está
+			out.write( pending.data(), pending.size() );
+			pending.clear();
+		}
+		else if ( close == nullptr )
+		{
+			pending.append( p, end - p );
+			return;
+		}
+		else
+		{
+			pending.append( p, close + 1 - p );
+			at += close + 1 - p;
+			expand( pending.data(), pending.data() + pending.size(), at - pending.size() );
+			pending.clear();
+			p = close + 1;
+		}
+	}
+
+	scan( p, end, at );
+}
+
+/**
+ * @brief      Encerra o documento, copiando um trecho inacabado
+ */
+void TemplateExpander::finish( void )
+{
+	out.write( pending.data(), pending.size() );
+	pending.clear();
+}
+
+/**
+ * @brief      Quantidade de trechos substituídos
+ */
+std::uint64_t TemplateExpander::expanded_count( void ) const
+{
+	return expanded;
+}
+
+/**
+ * @brief      Quantidade de trechos com erro
+ */
+std::uint64_t TemplateExpander::error_count( void ) const
+{
+	return failed;
+}
@@ -0,0 +1,260 @@
+/**
+ * @file thread_pool.cpp
+ * @brief      Implementação dos métodos da classe ThreadPool
+ * @details    Pool de threads com roubo de tarefas.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include "thread_pool.hpp"
+
+namespace
+{
+	thread_local const ThreadPool * current_pool = nullptr; // Pool da thread atual, se ela é de um
+	thread_local std::size_t current_queue = 0;             // Fila da thread atual nesse pool
+}
+
+/**
+ * @brief      Cria o pool
+ *
+ * @param[in]  threads  Quantidade de threads; 0 usa o número de núcleos
+ */
+ThreadPool::ThreadPool( std::size_t threads )
+	: pending( 0 )
+	, queued( 0 )
+	, next_queue( 0 )
+	, stopping( false )
+{
+	if ( threads == 0 )
+	{
+		threads = std::thread::hardware_concurrency();
+	}
+
+	// A thread que chama wait() também trabalha, então ela ocupa um dos lugares
+	auto extra = threads > 1 ? threads - 1 : 0;
+
+	for ( std::size_t i = 0; i <= extra; ++i )
+	{
+		queues.emplace_back( new Queue );
+	}
+
+	for ( std::size_t i = 1; i <= extra; ++i )
+	{
+		workers.emplace_back( [this, i]() { work( i ); } );
+	}
+}
+
+/**
+ * @brief      Destrutor, espera as tarefas pendentes de todos os lotes e
+ *             encerra as threads
+ */
+ThreadPool::~ThreadPool()
+{
+	help_until_done( pending );
+
+	{
+		std::lock_guard< std::mutex > guard( sleep_lock );
+		stopping = true;
+	}
+	wake.notify_all();
+
+	for ( auto & t : workers )
+	{
+		t.join();
+	}
+}
+
+/**
+ * @brief      Submete uma tarefa ao lote padrão do pool
+ *
+ * @param[in]  task  A tarefa
+ */
+void ThreadPool::submit( task_type task )
+{
+	submit( all, std::move( task ) );
+}
+
+/**
+ * @brief      Submete uma tarefa a um lote
+ *
+ * @param      group  O lote
+ * @param[in]  task   A tarefa
+ */
+void ThreadPool::submit( Group & group, task_type task )
+{
+	auto q = next_queue++ % queues.size();
+
+	++group.pending;
+	++pending;
+
+	// queued muda sob o lock do sono, então quem vai dormir não perde a
+	// notificação
+	{
+		std::lock_guard< std::mutex > guard( sleep_lock );
+		++queued;
+	}
+	{
+		std::lock_guard< std::mutex > guard( queues[ q ]->lock );
+		queues[ q ]->jobs.push_back( Job{ std::move( task ), &group } );
+	}
+	wake.notify_one();
+}
+
+/**
+ * @brief      Tenta obter uma tarefa, primeiro da própria fila e depois
+ *             roubando das demais
+ *
+ * @param[in]  self  Índice da fila da thread
+ * @param[out] job   A tarefa obtida
+ *
+ * @return     True se obteve uma tarefa, False caso contrário
+ */
+bool ThreadPool::take( std::size_t self, Job & job )
+{
+	{
+		std::lock_guard< std::mutex > guard( queues[ self ]->lock );
+		if ( not queues[ self ]->jobs.empty() )
+		{
+			job = std::move( queues[ self ]->jobs.back() );
+			queues[ self ]->jobs.pop_back();
+			--queued;
+			return true;
+		}
+	}
+
+	for ( std::size_t k = 1; k < queues.size(); ++k )
+	{
+		auto & victim = *queues[ ( self + k ) % queues.size() ];
+
+		std::lock_guard< std::mutex > guard( victim.lock );
+		if ( not victim.jobs.empty() )
+		{
+			job = std::move( victim.jobs.front() );
+			victim.jobs.pop_front();
+			--queued;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief      Executa uma tarefa e avisa quem espera se o lote dela ( ou o
+ *             pool inteiro ) terminou
+ *
+ * @param      job   A tarefa
+ */
+void ThreadPool::run( Job & job )
+{
+	job.task();
+	job.task = nullptr;
+
+	// O lote pode deixar de existir assim que o contador zera, então ele não
+	// é mais acessado depois disso
+	bool group_done = --job.group->pending == 0;
+	bool all_done = --pending == 0;
+
+	if ( group_done or all_done )
+	{
+		{
+			std::lock_guard< std::mutex > guard( sleep_lock );
+		}
+		wake.notify_all();
+	}
+}
+
+/**
+ * @brief      Executa tarefas na thread atual até o contador zerar
+ *
+ * @param[in]  counter  Tarefas ainda não concluídas que são esperadas
+ */
+void ThreadPool::help_until_done( const std::atomic< std::size_t > & counter )
+{
+	auto self = own_queue();
+	Job job;
+
+	while ( counter > 0 )
+	{
+		if ( take( self, job ) )
+		{
+			run( job );
+			continue;
+		}
+
+		// Nada para ajudar: dorme até o lote terminar ou chegar outra tarefa
+		std::unique_lock< std::mutex > guard( sleep_lock );
+		wake.wait( guard, [this, &counter]() { return counter == 0 or queued > 0; } );
+	}
+}
+
+/**
+ * @brief      Índice da fila da thread atual neste pool
+ *
+ * @return     O índice, ou 0 se ela não é uma thread do pool
+ */
+std::size_t ThreadPool::own_queue( void ) const
+{
+	return current_pool == this ? current_queue : 0;
+}
+
+/**
+ * @brief      Laço principal de cada thread do pool
+ *
+ * @param[in]  self  Índice da fila da thread
+ */
+void ThreadPool::work( std::size_t self )
+{
+	current_pool = this;
+	current_queue = self;
+
+	Job job;
+
+	while ( true )
+	{
+		if ( take( self, job ) )
+		{
+			run( job );
+			continue;
+		}
+
+		std::unique_lock< std::mutex > guard( sleep_lock );
+		wake.wait( guard, [this]() { return stopping or queued > 0; } );
+		if ( stopping )
+		{
+			return;
+		}
+	}
+}
+
+/**
+ * @brief      Executa tarefas na thread atual até as tarefas do lote padrão
+ *             terminarem
+ */
+void ThreadPool::wait( void )
+{
+	wait( all );
+}
+
+/**
+ * @brief      Executa tarefas na thread atual até as tarefas do lote
+ *             terminarem
+ *
+ * @param      group  O lote
+ */
+void ThreadPool::wait( Group & group )
+{
+	help_until_done( group.pending );
+}
+
+/**
+ * @brief      Informa quantas threads executam tarefas
+ *
+ * @return     Quantidade de threads
+ */
+std::size_t ThreadPool::size( void ) const
+{
+	return queues.size();
+}
@@ -0,0 +1,167 @@
+/**
+ * @file traffic_log.cpp
+ * @brief      Implementação dos métodos das classes TrafficRecorder e
+ *             TrafficLog
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstring>  	// std::memcmp, std::memcpy
+#include <fstream>  	// std::ifstream
+#include <iterator> 	// std::istreambuf_iterator
+
+#include "traffic_log.hpp"
+
+static_assert( sizeof( traffic::Header ) == 16, "Header deve ter 16 bytes" );
+
+/**
+ * @brief      Construtor do TrafficRecorder, escreve o cabeçalho
+ *
+ * @param[in]  fd    Descritor do arquivo do registro
+ */
+TrafficRecorder::TrafficRecorder( int fd )
+	: out( fd )
+	, start( clock_type::now() )
+{
+	traffic::Header h{};
+	std::memcpy( h.magic, traffic::MAGIC, sizeof( h.magic ) );
+	h.version = traffic::VERSION;
+
+	out.write( reinterpret_cast< const char * >( &h ), sizeof( h ) );
+}
+
+/**
+ * @brief      Escreve um inteiro com 7 bits por byte
+ *
+ * @param[in]  v     O inteiro
+ */
+void TrafficRecorder::write_varint( std::uint64_t v )
+{
+	char bytes[10];
+	std::size_t n = 0;
+
+	while ( v >= 0x80 )
+	{
+		bytes[ n++ ] = static_cast< char >( v | 0x80 );
+		v >>= 7;
+	}
+	bytes[ n++ ] = static_cast< char >( v );
+
+	out.write( bytes, n );
+}
+
+/**
+ * @brief      Registra uma linha que acabou de chegar
+ *
+ * @param[in]  line  A linha, sem o '\n'
+ */
+void TrafficRecorder::record( const std::string & line )
+{
+	auto now = static_cast< std::uint64_t >(
+		std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - start ).count() );
+
+	write_varint( now - last );
+	write_varint( line.size() );
+	out.write( line.data(), line.size() );
+
+	last = now;
+}
+
+/**
+ * @brief      Descarrega o que ainda está no buffer
+ *
+ * @return     True se todas as escritas deram certo
+ */
+bool TrafficRecorder::flush( void )
+{
+	return out.flush();
+}
+
+/**
+ * @brief      Carrega um registro gravado pelo TrafficRecorder
+ *
+ * @param[in]  path  Caminho do arquivo
+ *
+ * @return     Vazio se carregou, ou a descrição do erro
+ */
+std::string TrafficLog::open( const std::string & path )
+{
+	entries.clear();
+
+	std::ifstream file( path, std::ios::binary );
+	if ( not file )
+	{
+		return "cannot open " + path;
+	}
+
+	std::string data( ( std::istreambuf_iterator< char >( file ) ), std::istreambuf_iterator< char >() );
+
+	traffic::Header h;
+	if ( data.size() < sizeof( h ) )
+	{
+		return "truncated traffic log " + path;
+	}
+
+	std::memcpy( &h, data.data(), sizeof( h ) );
+	if ( std::memcmp( h.magic, traffic::MAGIC, sizeof( h.magic ) ) != 0 or h.version != traffic::VERSION )
+	{
+		return "not a bares traffic log: " + path;
+	}
+
+	std::size_t pos = sizeof( h );
+
+	// Falha se o inteiro termina depois do fim dos dados
+	auto read_varint = [&]( std::uint64_t & v ) -> bool
+	{
+		v = 0;
+		for ( unsigned shift = 0; pos < data.size() and shift < 64; shift += 7 )
+		{
+			auto b = static_cast< unsigned char >( data[ pos++ ] );
+			v |= static_cast< std::uint64_t >( b & 0x7f ) << shift;
+			if ( not ( b & 0x80 ) )
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	std::uint64_t at = 0;
+	std::uint64_t delta, length;
+
+	while ( pos < data.size() )
+	{
+		if ( not read_varint( delta ) or not read_varint( length ) or length > data.size() - pos )
+		{
+			break;
+		}
+
+		at += delta;
+		entries.push_back( traffic::Record{ at, data.substr( pos, length ) } );
+		pos += length;
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Recupera as linhas na ordem de chegada
+ *
+ * @return     As linhas e seus instantes
+ */
+const std::vector< traffic::Record > & TrafficLog::records( void ) const
+{
+	return entries;
+}
+
+/**
+ * @brief      Informa a duração da gravação
+ *
+ * @return     Instante da última linha, em nanossegundos
+ */
+std::uint64_t TrafficLog::duration_ns( void ) const
+{
+	return entries.empty() ? 0 : entries.back().at_ns;
+}
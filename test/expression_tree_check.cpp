@@ -0,0 +1,208 @@
+/**
+ * @file expression_tree_check.cpp
+ * @brief      Confere as edições da ExpressionTree contra o Evaluator
+ * @details    Cada expressão ( as de data/input.txt, cadeias longas e
+ *             expressões aleatórias ) vira uma ExpressionTree. Depois de cada
+ *             troca de literal, result() é comparado com evaluate_postfix da
+ *             posfixa com o mesmo literal trocado. As trocas incluem zeros
+ *             ( divisão por zero ), valores que estouram as contas e valores
+ *             fora da faixa do Parser, que precisam ser recusados sem mudar
+ *             o resultado.
+ *
+ *             Uso: ./bin/expression_tree_check < data/input.txt
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <chrono>   	// std::chrono
+#include <iostream> 	// std::cout
+#include <limits>   	// std::numeric_limits
+#include <random>   	// std::mt19937
+#include <string>   	// std::string, std::to_string
+#include <vector>   	// std::vector
+
+#include "parser.hpp"
+#include "evaluator.hpp"
+#include "expression_tree.hpp"
+
+using value_type = Evaluator::value_type;
+
+constexpr value_type MAX = std::numeric_limits< Parser::required_int_type >::max();
+
+/**
+ * @brief      Confere edições de uma expressão
+ *
+ * @param[in]  expr   A expressão
+ * @param[in]  edits  Quantidade de edições aleatórias
+ * @param      rng    Gerador dos índices e dos valores
+ *
+ * @return     Quantidade de divergências
+ */
+int check( const std::string & expr, std::size_t edits, std::mt19937 & rng )
+{
+	Parser parser;
+	Evaluator evaluator;
+
+	if ( parser.parse( expr ).type != Parser::ParserResult::PARSER_OK )
+	{
+		return 0;
+	}
+
+	auto postfix = evaluator.infix_to_postfix( parser.get_tokens() );
+	ExpressionTree tree( postfix );
+
+	// Os literais da árvore seguem a ordem em que aparecem na posfixa
+	std::vector< std::size_t > operands;
+	for ( std::size_t i = 0; i < postfix.size(); ++i )
+	{
+		if ( postfix[ i ].type == Token::token_t::OPERAND )
+		{
+			operands.push_back( i );
+		}
+	}
+
+	const value_type values[] = { 0, 1, -1, 2, 7, 181, 182, -182, 1000, 32766, -32767 };
+	int failures = 0;
+
+	auto compare = [&]( const std::string & what )
+	{
+		auto expected = evaluator.evaluate_postfix( postfix );
+		auto got = tree.result();
+		if ( expected.value != got.value or expected.type != got.type )
+		{
+			std::cout << "MISMATCH in \"" << expr.substr( 0, 60 ) << "\" after " << what
+			          << ": got " << got.value << " ( " << got.type << " ), expected "
+			          << expected.value << " ( " << expected.type << " )\n";
+			++failures;
+		}
+	};
+
+	compare( "build" );
+
+	for ( std::size_t e = 0; e < edits and not operands.empty(); ++e )
+	{
+		auto index = rng() % operands.size();
+		auto value = rng() % 4 == 0 ? static_cast< value_type >( rng() % ( 2 * MAX - 1 ) ) - MAX + 1
+		                            : values[ rng() % ( sizeof( values ) / sizeof( values[0] ) ) ];
+		auto what = "literal " + std::to_string( index ) + " = " + std::to_string( value );
+
+		auto edited = tree.replace_literal( index, value );
+		if ( edited.type != Parser::ParserResult::PARSER_OK )
+		{
+			std::cout << "REJECTED " << what << "\n";
+			++failures;
+			continue;
+		}
+
+		postfix[ operands[ index ] ].value = std::to_string( value );
+		compare( what );
+	}
+
+	// Fora da faixa do Parser: recusado, sem mudar o resultado
+	if ( not operands.empty() )
+	{
+		auto before = tree.result();
+		auto edited = tree.replace_literal( 0, MAX + 1 );
+		auto after = tree.result();
+		if ( edited.type != Parser::ParserResult::INTEGER_OUT_OF_RANGE
+			or after.value != before.value or after.type != before.type )
+		{
+			std::cout << "ACCEPTED out of range literal in \"" << expr.substr( 0, 60 ) << "\"\n";
+			++failures;
+		}
+	}
+
+	return failures;
+}
+
+/**
+ * @brief      Gera uma expressão aleatória com todos os operadores e
+ *             parênteses
+ *
+ * @param      rng    Gerador
+ * @param[in]  terms  Quantidade de literais
+ *
+ * @return     A expressão
+ */
+std::string random_expression( std::mt19937 & rng, std::size_t terms )
+{
+	const char ops[] = { '+', '-', '*', '/', '%', '^', '+', '-', '*' };
+	std::string expr;
+	std::size_t open = 0;
+
+	for ( std::size_t i = 0; i < terms; ++i )
+	{
+		if ( rng() % 5 == 0 )
+		{
+			expr += "(";
+			++open;
+		}
+		expr += std::to_string( rng() % 3 == 0 ? rng() % 300 : rng() % 10 );
+		if ( open > 0 and rng() % 4 == 0 )
+		{
+			expr += ")";
+			--open;
+		}
+		if ( i + 1 < terms )
+		{
+			expr += ops[ rng() % sizeof( ops ) ];
+		}
+	}
+
+	return expr + std::string( open, ')' );
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @return     0 se todas as edições concordaram, 1 caso contrário
+ */
+int main( void )
+{
+	std::mt19937 rng( 2026 );
+	std::string line;
+	int failures = 0;
+
+	while ( std::getline( std::cin, line ) )
+	{
+		failures += check( line, 50, rng );
+	}
+
+	for ( std::size_t i = 0; i < 2000; ++i )
+	{
+		failures += check( random_expression( rng, 1 + rng() % 40 ), 20, rng );
+	}
+
+	// Cadeias longas, em que o caminho até a raiz tem o tamanho da expressão
+	std::string sum = "1", mixed = "3";
+	for ( std::size_t i = 1; i < 100000; ++i )
+	{
+		sum += "+1";
+		mixed += std::string( 1, "+-*"[ i % 3 ] ) + std::to_string( 1 + i % 5 );
+	}
+	failures += check( sum, 200, rng );
+	failures += check( mixed, 200, rng );
+
+	// Tempo de uma edição do primeiro literal da cadeia de 100k termos
+	{
+		Parser parser;
+		Evaluator evaluator;
+		parser.parse( sum );
+		ExpressionTree tree( evaluator.infix_to_postfix( parser.get_tokens() ) );
+
+		constexpr std::size_t EDITS = 10000;
+		auto start = std::chrono::steady_clock::now();
+		for ( std::size_t i = 0; i < EDITS; ++i )
+		{
+			tree.replace_literal( 0, static_cast< value_type >( i % 100 ) );
+		}
+		auto ns = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ).count();
+		std::cout << "edit of the first literal of 100k terms: " << ns / EDITS << " ns\n";
+	}
+
+	std::cout << ( failures == 0 ? "expression tree: ok\n" : "expression tree: FAILED\n" );
+
+	return failures == 0 ? 0 : 1;
+}
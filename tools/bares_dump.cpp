@@ -0,0 +1,202 @@
+/**
+ * @file bares_dump.cpp
+ * @brief      Leitor da saída binária do bares
+ * @details    Converte os registros gravados por "bares --binary" de volta no
+ *             texto que o bares escreveria ( com as mesmas rotinas do
+ *             OutputWriter ), para depuração e comparação. Com a opção
+ *             "--records" cada registro é exibido por campo: linha, etapa,
+ *             código, coluna e valor, separados por tabulação.
+ *
+ *             Uso: ./bin/bares_dump [--records] [arquivo]
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno, EINTR
+#include <cstring>  	// std::memcpy, std::strerror
+#include <iostream> 	// std::cerr
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include <fcntl.h>  	// open
+#include <unistd.h> 	// read, close
+
+#include "binary_output.hpp"
+#include "output_writer.hpp"
+
+/**
+ * @brief      Lê até n bytes, repetindo leituras curtas
+ *
+ * @param[in]  fd    O descritor
+ * @param      data  Destino
+ * @param[in]  n     Bytes pedidos
+ *
+ * @return     Bytes lidos ( menos que n só no fim ), ou -1 em erro
+ */
+ssize_t read_full( int fd, char * data, std::size_t n )
+{
+	std::size_t done = 0;
+
+	while ( done < n )
+	{
+		auto r = ::read( fd, data + done, n - done );
+		if ( r < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( r < 0 )
+		{
+			return -1;
+		}
+		if ( r == 0 )
+		{
+			break;
+		}
+		done += r;
+	}
+
+	return static_cast< ssize_t >( done );
+}
+
+/**
+ * @brief      Escreve um registro como o bares escreveria a linha
+ *
+ * @param      out   O escritor
+ * @param[in]  r     O registro
+ */
+void write_text( OutputWriter & out, const binary_output::Record & r )
+{
+	switch ( r.stage )
+	{
+		case binary_output::OK:
+			out.write_value( r.value );
+			break;
+		case binary_output::PARSER:
+			out.write_parser_error( Parser::ParserResult( static_cast< Parser::ParserResult::code_t >( r.code ), r.column ) );
+			break;
+		default:
+			out.write_evaluator_error( Evaluator::EvaluatorResult( 0, static_cast< Evaluator::EvaluatorResult::code_t >( r.code ) ) );
+			break;
+	}
+}
+
+/**
+ * @brief      Escreve os campos de um registro separados por tabulação
+ *
+ * @param      out   O escritor
+ * @param[in]  r     O registro
+ */
+void write_fields( OutputWriter & out, const binary_output::Record & r )
+{
+	char line[ 5 * ( OutputWriter::MAX_INTEGER_CHARS + 1 ) ];
+	char * p = line;
+
+	p = OutputWriter::format_integer( p, static_cast< long long >( r.line ) );
+	*p++ = '\t';
+	p = OutputWriter::format_integer( p, r.stage );
+	*p++ = '\t';
+	p = OutputWriter::format_integer( p, r.code );
+	*p++ = '\t';
+	p = OutputWriter::format_integer( p, r.column );
+	*p++ = '\t';
+	p = OutputWriter::format_integer( p, r.value );
+	*p++ = '\n';
+
+	out.write( line, p - line );
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0, ou 1 se a entrada não é uma saída binária válida
+ */
+int main( int argc, char const *argv[] )
+{
+	bool records = false;
+	int arg = 1;
+
+	if ( arg < argc and std::string( argv[ arg ] ) == "--records" )
+	{
+		records = true;
+		++arg;
+	}
+
+	int fd = 0;
+	if ( arg < argc )
+	{
+		fd = ::open( argv[ arg ], O_RDONLY | O_CLOEXEC );
+		if ( fd < 0 )
+		{
+			std::cerr << "bares_dump: cannot open " << argv[ arg ] << ": " << std::strerror( errno ) << "\n";
+			return 1;
+		}
+	}
+
+	binary_output::Header header;
+	if ( read_full( fd, reinterpret_cast< char * >( &header ), sizeof( header ) ) != sizeof( header ) )
+	{
+		std::cerr << "bares_dump: missing header\n";
+		return 1;
+	}
+
+	auto problem = binary_output::check( header );
+	if ( not problem.empty() )
+	{
+		std::cerr << "bares_dump: " << problem << "\n";
+		return 1;
+	}
+
+	// Lê blocos inteiros e converte os registros de cada um
+	std::vector< char > block( BinaryWriter::BLOCK );
+	OutputWriter out;
+	std::size_t pending = 0;
+
+	while ( true )
+	{
+		auto n = read_full( fd, block.data() + pending, block.size() - pending );
+		if ( n < 0 )
+		{
+			std::cerr << "bares_dump: read error: " << std::strerror( errno ) << "\n";
+			return 1;
+		}
+
+		std::size_t available = pending + n;
+		std::size_t used = 0;
+
+		for ( ; used + sizeof( binary_output::Record ) <= available; used += sizeof( binary_output::Record ) )
+		{
+			binary_output::Record r;
+			std::memcpy( &r, block.data() + used, sizeof( r ) );
+
+			if ( records )
+			{
+				write_fields( out, r );
+			}
+			else
+			{
+				write_text( out, r );
+			}
+		}
+
+		pending = available - used;
+		std::memcpy( block.data(), block.data() + used, pending );
+
+		if ( n == 0 )
+		{
+			break;
+		}
+	}
+
+	if ( pending != 0 )
+	{
+		std::cerr << "bares_dump: truncated record at the end\n";
+		return 1;
+	}
+
+	return out.flush() ? 0 : 1;
+}
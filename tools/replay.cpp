@@ -0,0 +1,231 @@
+/**
+ * @file replay.cpp
+ * @brief      Reprodução de tráfego gravado com "bares --record"
+ * @details    Entrega as linhas de um registro ao Parser e ao Evaluator desta
+ *             compilação no ritmo original, em um ritmo multiplicado ou o mais
+ *             rápido possível, e informa a vazão e os percentis da latência.
+ *             A latência de uma linha vai do instante em que ela deveria
+ *             chegar até o fim da sua avaliação, então inclui a espera quando
+ *             a avaliação fica atrás do ritmo. Com uma saída de referência (
+ *             por exemplo "bares < entrada" de outra compilação ), as linhas
+ *             diferentes são contadas e as primeiras são exibidas.
+ *
+ *             Uso: ./bin/replay registro [velocidade] [saida_referencia]
+ *
+ *             velocidade 1 reproduz o ritmo original, 2 o dobro, 0.5 a
+ *             metade e 0 sem esperas.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <algorithm>	// std::sort, std::min
+#include <chrono>   	// std::chrono
+#include <cstdint>  	// std::uint64_t
+#include <cstdlib>  	// std::strtod
+#include <fstream>  	// std::ifstream
+#include <iomanip>  	// std::setprecision
+#include <iostream> 	// std::cout
+#include <string>   	// std::string
+#include <thread>   	// std::this_thread::sleep_until
+#include <vector>   	// std::vector
+
+#include "parser.hpp"
+#include "evaluator.hpp"
+#include "output_writer.hpp"
+#include "traffic_log.hpp"
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief      Quantidade de diferenças exibidas
+ */
+constexpr std::size_t SHOWN_DIFFS = 10;
+
+/**
+ * @brief      Percentil de uma amostra ordenada
+ *
+ * @param[in]  sorted  Latências em ordem crescente
+ * @param[in]  p       Percentil, entre 0 e 1
+ *
+ * @return     O valor do percentil, em microssegundos
+ */
+double percentile( const std::vector< std::uint64_t > & sorted, double p )
+{
+	if ( sorted.empty() )
+	{
+		return 0;
+	}
+
+	auto k = static_cast< std::size_t >( p * ( sorted.size() - 1 ) + 0.5 );
+	return sorted[ std::min( k, sorted.size() - 1 ) ] / 1e3;
+}
+
+/**
+ * @brief      Separa um texto em linhas ( como std::getline )
+ */
+std::vector< std::string > split_lines( const std::vector< char > & text )
+{
+	std::vector< std::string > lines;
+	std::size_t begin = 0;
+
+	while ( begin < text.size() )
+	{
+		std::size_t end = begin;
+		while ( end < text.size() and text[ end ] != '\n' )
+		{
+			++end;
+		}
+		lines.emplace_back( text.data() + begin, end - begin );
+		begin = end + 1;
+	}
+
+	return lines;
+}
+
+/**
+ * @brief      Função Principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0 se não houve diferenças, 1 caso contrário
+ */
+int main( int argc, char const *argv[] )
+{
+	if ( argc < 2 )
+	{
+		std::cerr << "Uso: " << argv[0] << " registro [velocidade] [saida_referencia]\n";
+		return 1;
+	}
+
+	TrafficLog log;
+	auto error = log.open( argv[1] );
+	if ( not error.empty() )
+	{
+		std::cerr << "replay: " << error << "\n";
+		return 1;
+	}
+
+	double speed = argc > 2 ? std::strtod( argv[2], nullptr ) : 1.0;
+	if ( speed < 0 )
+	{
+		speed = 0;
+	}
+
+	const auto & records = log.records();
+
+	Parser parser;
+	Evaluator evaluator;
+	OutputWriter out( OutputWriter::MEMORY );
+
+	std::vector< std::uint64_t > latency;
+	latency.reserve( records.size() );
+
+	auto start = clock_type::now();
+
+	for ( const auto & r : records )
+	{
+		// Sem esperas, a linha "chega" quando a anterior termina
+		auto due = clock_type::now();
+		if ( speed > 0 )
+		{
+			due = start + std::chrono::duration_cast< clock_type::duration >(
+				std::chrono::nanoseconds( static_cast< std::uint64_t >( r.at_ns / speed ) ) );
+			std::this_thread::sleep_until( due );
+		}
+
+		auto result = parser.parse( r.line );
+
+		if ( result.type != Parser::ParserResult::PARSER_OK )
+		{
+			out.write_parser_error( result );
+		}
+		else
+		{
+			auto resultado = evaluator.evaluate_postfix( evaluator.infix_to_postfix( parser.get_tokens() ) );
+
+			if ( resultado.type != Evaluator::EvaluatorResult::code_t::RESULT_OK )
+			{
+				out.write_evaluator_error( resultado );
+			}
+			else
+			{
+				out.write_value( resultado.value );
+			}
+		}
+
+		latency.push_back( static_cast< std::uint64_t >(
+			std::chrono::duration_cast< std::chrono::nanoseconds >( clock_type::now() - due ).count() ) );
+	}
+
+	double elapsed = std::chrono::duration< double >( clock_type::now() - start ).count();
+
+	std::sort( latency.begin(), latency.end() );
+
+	std::cout << std::fixed << std::setprecision( 3 );
+	std::cout << "lines: " << records.size() << "\n";
+	std::cout << "recorded duration: " << log.duration_ns() / 1e9 << " s\n";
+	std::cout << "replay duration: " << elapsed << " s (speed ";
+	if ( speed > 0 )
+	{
+		std::cout << speed << "x)\n";
+	}
+	else
+	{
+		std::cout << "max)\n";
+	}
+	std::cout << "throughput: " << ( elapsed > 0 ? records.size() / elapsed : 0 ) << " lines/s\n";
+	std::cout << "latency (us): p50 " << percentile( latency, 0.50 )
+		<< "  p90 " << percentile( latency, 0.90 )
+		<< "  p99 " << percentile( latency, 0.99 )
+		<< "  p99.9 " << percentile( latency, 0.999 )
+		<< "  max " << percentile( latency, 1.0 ) << "\n";
+
+	if ( argc <= 3 )
+	{
+		return 0;
+	}
+
+	std::ifstream file( argv[3], std::ios::binary );
+	if ( not file )
+	{
+		std::cerr << "replay: cannot open " << argv[3] << "\n";
+		return 1;
+	}
+
+	std::vector< std::string > expected;
+	std::string line;
+	while ( std::getline( file, line ) )
+	{
+		expected.push_back( line );
+	}
+
+	auto actual = split_lines( out.release() );
+
+	std::size_t diffs = 0;
+	auto n = std::max( expected.size(), actual.size() );
+
+	for ( std::size_t i = 0; i < n; ++i )
+	{
+		const std::string none = "<missing>";
+		const auto & want = i < expected.size() ? expected[ i ] : none;
+		const auto & got = i < actual.size() ? actual[ i ] : none;
+
+		if ( want != got )
+		{
+			if ( diffs < SHOWN_DIFFS )
+			{
+				std::cout << "line " << i + 1 << ": " << ( i < records.size() ? records[ i ].line : none ) << "\n"
+					<< "  reference: " << want << "\n"
+					<< "  this build: " << got << "\n";
+			}
+			++diffs;
+		}
+	}
+
+	std::cout << "differences: " << diffs << " of " << n << " lines\n";
+
+	return diffs == 0 ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file shard_merge.cpp
+ * @brief      Junta as saídas das partes na ordem original da entrada
+ * @details    Antes de escrever qualquer coisa confere todas as partes do
+ *             manifesto: o registro ".done" precisa existir, ter uma linha de
+ *             saída por linha da parte e bater com as linhas, os bytes e o
+ *             checksum do arquivo ".out". Só então as saídas são concatenadas
+ *             na ordem do manifesto, o que reproduz exatamente a saída de um
+ *             único "bares" sobre a entrada inteira.
+ *
+ *             Uso: ./bin/shard_merge <manifesto> [saída]
+ *
+ *             Sem arquivo de saída, escreve na saída padrão. Com ele, grava em
+ *             um arquivo ao lado e o renomeia no fim.
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cerrno>   	// errno, EINTR
+#include <cstring>  	// std::strerror
+#include <iostream> 	// std::cerr
+#include <string>   	// std::string
+#include <vector>   	// std::vector
+
+#include <fcntl.h>  	// open
+#include <stdio.h>  	// rename
+#include <unistd.h> 	// read, close, unlink
+
+#include "output_writer.hpp"
+#include "shard_manifest.hpp"
+
+/**
+ * @brief      Confere a saída de uma parte
+ *
+ * @param[in]  manifest_path  Caminho do manifesto
+ * @param[in]  shard          A parte
+ *
+ * @return     Vazio se confere, ou a descrição do problema
+ */
+std::string verify( const std::string & manifest_path, const sharding::Shard & shard )
+{
+	auto base = sharding::resolve( manifest_path, shard.file );
+	sharding::Done done, found;
+
+	auto error = sharding::read_done( base + ".done", done );
+	if ( not error.empty() )
+	{
+		return error;
+	}
+	if ( done.lines != shard.lines )
+	{
+		return base + ".done: " + std::to_string( done.lines ) + " results for " + std::to_string( shard.lines ) + " lines";
+	}
+
+	error = sharding::scan_file( base + ".out", found );
+	if ( not error.empty() )
+	{
+		return error;
+	}
+	if ( found.lines != done.lines or found.bytes != done.bytes or found.checksum != done.checksum )
+	{
+		return base + ".out does not match " + base + ".done";
+	}
+
+	return "";
+}
+
+/**
+ * @brief      Copia um arquivo para a saída
+ *
+ * @param[in]  path  Caminho
+ * @param      out   A saída
+ *
+ * @return     Vazio se copiou, ou a descrição do erro
+ */
+std::string append( const std::string & path, OutputWriter & out )
+{
+	int fd = ::open( path.c_str(), O_RDONLY );
+	if ( fd < 0 )
+	{
+		return "cannot open " + path + ": " + std::strerror( errno );
+	}
+
+	std::vector< char > block( 1 << 20 );
+	while ( true )
+	{
+		auto n = ::read( fd, block.data(), block.size() );
+		if ( n < 0 and errno == EINTR )
+		{
+			continue;
+		}
+		if ( n <= 0 )
+		{
+			auto err = errno;
+			::close( fd );
+			return n == 0 ? "" : "cannot read " + path + ": " + std::strerror( err );
+		}
+		out.write( block.data(), n );
+	}
+}
+
+/**
+ * @brief      Função principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0, ou 1 se alguma parte não confere
+ */
+int main( int argc, char const *argv[] )
+{
+	if ( argc < 2 )
+	{
+		std::cerr << "Uso: " << argv[0] << " <manifesto> [saída]\n";
+		return 1;
+	}
+
+	std::string manifest_path = argv[1];
+	sharding::Manifest manifest;
+
+	auto error = sharding::read_manifest( manifest_path, manifest );
+	if ( not error.empty() )
+	{
+		std::cerr << "shard_merge: " << error << "\n";
+		return 1;
+	}
+
+	bool ok = true;
+	for ( std::size_t k = 0; k < manifest.shards.size(); ++k )
+	{
+		error = verify( manifest_path, manifest.shards[ k ] );
+		if ( not error.empty() )
+		{
+			std::cerr << "shard_merge: shard " << k << ": " << error << "\n";
+			ok = false;
+		}
+	}
+	if ( not ok )
+	{
+		return 1;
+	}
+
+	std::string tmp = argc >= 3 ? std::string( argv[2] ) + ".tmp" : "";
+	int fd = tmp.empty() ? 1 : ::open( tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+	if ( fd < 0 )
+	{
+		std::cerr << "shard_merge: cannot open " << tmp << ": " << std::strerror( errno ) << "\n";
+		return 1;
+	}
+
+	{
+		OutputWriter out( fd, OutputWriter::size_type( 1 ) << 20 );
+		for ( std::size_t k = 0; k < manifest.shards.size() and ok; ++k )
+		{
+			error = append( sharding::resolve( manifest_path, manifest.shards[ k ].file ) + ".out", out );
+			if ( not error.empty() )
+			{
+				std::cerr << "shard_merge: shard " << k << ": " << error << "\n";
+				ok = false;
+			}
+		}
+		ok = out.flush() and ok;
+	}
+
+	if ( tmp.empty() )
+	{
+		return ok ? 0 : 1;
+	}
+
+	::close( fd );
+	if ( not ok or ::rename( tmp.c_str(), argv[2] ) != 0 )
+	{
+		std::cerr << "shard_merge: cannot write " << argv[2] << "\n";
+		::unlink( tmp.c_str() );
+		return 1;
+	}
+
+	return 0;
+}
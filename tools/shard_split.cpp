@@ -0,0 +1,157 @@
+/**
+ * @file shard_split.cpp
+ * @brief      Divide uma entrada em partes de custo equilibrado
+ * @details    Lê o arquivo duas vezes: a primeira soma o custo estimado de
+ *             todas as linhas ( sharding::line_cost ) e a segunda grava as
+ *             partes, fechando a parte k assim que o custo acumulado alcança
+ *             ( k + 1 ) / N do total. Os cortes são sempre em limites de
+ *             linha e dependem apenas do conteúdo, então a mesma entrada gera
+ *             sempre as mesmas partes. Como no bares, a entrada termina na
+ *             linha "q" ou "p"; toda linha gravada termina com '\n'.
+ *
+ *             Uso: ./bin/shard_split <entrada> <partes> [prefixo]
+ *
+ *             Grava <prefixo>.shard000, <prefixo>.shard001, ... e o manifesto
+ *             <prefixo>.manifest ( o prefixo padrão é a própria entrada ).
+ *
+ * @author     João Vítor Venceslau Coelho
+ * @since      18/10/2026
+ * @date       18/10/2026
+ */
+
+#include <cstdio>   	// std::snprintf
+#include <cstdlib>  	// std::strtoul
+#include <fstream>  	// std::ifstream, std::ofstream
+#include <iostream> 	// std::cout, std::cerr
+#include <string>   	// std::string
+
+#include "shard_manifest.hpp"
+
+/**
+ * @brief      Nome do arquivo de uma parte
+ *
+ * @param[in]  prefix  Prefixo
+ * @param[in]  index   Índice da parte
+ *
+ * @return     O nome
+ */
+std::string shard_name( const std::string & prefix, std::size_t index )
+{
+	char suffix[ 32 ];
+	std::snprintf( suffix, sizeof suffix, ".shard%03zu", index );
+	return prefix + suffix;
+}
+
+/**
+ * @brief      Função principal
+ *
+ * @param[in]  argc  The argc
+ * @param      argv  The argv
+ *
+ * @return     0, ou 1 em erro
+ */
+int main( int argc, char const *argv[] )
+{
+	if ( argc < 3 or std::strtoul( argv[2], nullptr, 10 ) == 0 )
+	{
+		std::cerr << "Uso: " << argv[0] << " <entrada> <partes> [prefixo]\n";
+		return 1;
+	}
+
+	std::string input_path = argv[1];
+	std::size_t count = std::strtoul( argv[2], nullptr, 10 );
+	std::string prefix = argc >= 4 ? argv[3] : input_path;
+
+	sharding::Manifest manifest;
+	manifest.input = input_path;
+
+	// Primeira passada: custo total
+	std::uint64_t total = 0;
+	std::string line;
+	{
+		std::ifstream in( input_path, std::ios::binary );
+		if ( not in )
+		{
+			std::cerr << "shard_split: cannot open " << input_path << "\n";
+			return 1;
+		}
+
+		while ( std::getline( in, line ) and line != "q" and line != "p" )
+		{
+			total += sharding::line_cost( line.data(), line.size() );
+			++manifest.lines;
+			manifest.bytes += line.size() + 1;
+		}
+		if ( in.bad() )
+		{
+			std::cerr << "shard_split: cannot read " << input_path << "\n";
+			return 1;
+		}
+	}
+
+	// Segunda passada: grava as partes
+	std::ifstream in( input_path, std::ios::binary );
+	auto slash = prefix.rfind( '/' );
+	std::uint64_t cost = 0;
+	std::uint64_t line_index = 0;
+
+	for ( std::size_t k = 0; k < count; ++k )
+	{
+		sharding::Shard shard;
+		auto path = shard_name( prefix, k );
+		shard.file = slash == std::string::npos ? path : path.substr( slash + 1 );
+		shard.first_line = line_index;
+
+		std::ofstream out( path, std::ios::binary | std::ios::trunc );
+		sharding::Checksum checksum;
+
+		// A última parte leva o que sobrar, mesmo com arredondamentos
+		std::uint64_t limit = k + 1 == count ? total : total / count * ( k + 1 ) + total % count * ( k + 1 ) / count;
+
+		while ( ( cost < limit or k + 1 == count ) and line_index < manifest.lines and std::getline( in, line ) )
+		{
+			auto c = sharding::line_cost( line.data(), line.size() );
+			line.push_back( '\n' );
+			out.write( line.data(), line.size() );
+			checksum.update( line.data(), line.size() );
+
+			cost += c;
+			shard.cost += c;
+			shard.bytes += line.size();
+			++shard.lines;
+			++line_index;
+		}
+
+		out.flush();
+		if ( not out )
+		{
+			std::cerr << "shard_split: cannot write " << path << "\n";
+			return 1;
+		}
+
+		shard.checksum = checksum.value();
+		manifest.shards.push_back( shard );
+	}
+
+	if ( line_index != manifest.lines )
+	{
+		std::cerr << "shard_split: " << input_path << " changed while splitting\n";
+		return 1;
+	}
+
+	auto error = sharding::write_manifest( prefix + ".manifest", manifest );
+	if ( not error.empty() )
+	{
+		std::cerr << "shard_split: " << error << "\n";
+		return 1;
+	}
+
+	for ( std::size_t k = 0; k < manifest.shards.size(); ++k )
+	{
+		const auto & s = manifest.shards[ k ];
+		std::cout << s.file << ": lines " << s.first_line << "-" << s.first_line + s.lines
+			<< ", " << s.bytes << " bytes, cost " << s.cost << "\n";
+	}
+
+	return 0;
+}